@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StartupBenchmark.dir/bench/StartupBenchmark.cpp.o"
+  "CMakeFiles/StartupBenchmark.dir/bench/StartupBenchmark.cpp.o.d"
+  "StartupBenchmark"
+  "StartupBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StartupBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WebsiteGenerator.dir/project/main.cpp.o"
+  "CMakeFiles/WebsiteGenerator.dir/project/main.cpp.o.d"
+  "WebsiteGenerator"
+  "WebsiteGenerator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WebsiteGenerator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
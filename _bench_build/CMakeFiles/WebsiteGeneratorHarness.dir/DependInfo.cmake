@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/project/src/GemtextCorpus.cpp" "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/GemtextCorpus.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/GemtextCorpus.cpp.o.d"
+  "/root/repo/project/src/TranslatorHarness.cpp" "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/TranslatorHarness.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/TranslatorHarness.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/CMakeFiles/WebsiteGeneratorLib.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/project/main.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/main.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/main.cpp.o.d"
+  "/root/repo/project/src/FSEntryFinder.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FSEntryFinder.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FSEntryFinder.cpp.o.d"
+  "/root/repo/project/src/FileSystem.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FileSystem.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FileSystem.cpp.o.d"
+  "/root/repo/project/src/Generator.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Generator.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Generator.cpp.o.d"
+  "/root/repo/project/src/HtmlEscape.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/HtmlEscape.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/HtmlEscape.cpp.o.d"
+  "/root/repo/project/src/PageCache.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PageCache.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PageCache.cpp.o.d"
+  "/root/repo/project/src/PathTable.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PathTable.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PathTable.cpp.o.d"
+  "/root/repo/project/src/PreviewServer.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PreviewServer.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PreviewServer.cpp.o.d"
+  "/root/repo/project/src/Rules.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Rules.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Rules.cpp.o.d"
+  "/root/repo/project/src/Scheduler.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Scheduler.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Scheduler.cpp.o.d"
+  "/root/repo/project/src/Sharding.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Sharding.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Sharding.cpp.o.d"
+  "/root/repo/project/src/Translator.cpp" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Translator.cpp.o" "gcc" "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Translator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
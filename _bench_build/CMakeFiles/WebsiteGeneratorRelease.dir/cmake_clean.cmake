@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/main.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/main.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FSEntryFinder.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FSEntryFinder.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FileSystem.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/FileSystem.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Generator.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Generator.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/HtmlEscape.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/HtmlEscape.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PageCache.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PageCache.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PathTable.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PathTable.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PreviewServer.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/PreviewServer.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Rules.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Rules.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Scheduler.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Scheduler.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Sharding.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Sharding.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Translator.cpp.o"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/project/src/Translator.cpp.o.d"
+  "WebsiteGeneratorRelease"
+  "WebsiteGeneratorRelease.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WebsiteGeneratorRelease.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
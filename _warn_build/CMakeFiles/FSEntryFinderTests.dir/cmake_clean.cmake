@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FSEntryFinderTests.dir/tests/FSEntryFinderTests.cpp.o"
+  "CMakeFiles/FSEntryFinderTests.dir/tests/FSEntryFinderTests.cpp.o.d"
+  "FSEntryFinderTests"
+  "FSEntryFinderTests.pdb"
+  "FSEntryFinderTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FSEntryFinderTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FileSystemTests.dir/tests/FileSystemTests.cpp.o"
+  "CMakeFiles/FileSystemTests.dir/tests/FileSystemTests.cpp.o.d"
+  "FileSystemTests"
+  "FileSystemTests.pdb"
+  "FileSystemTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FileSystemTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
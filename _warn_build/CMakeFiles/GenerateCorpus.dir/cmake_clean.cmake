@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GenerateCorpus.dir/fuzz/GenerateCorpus.cpp.o"
+  "CMakeFiles/GenerateCorpus.dir/fuzz/GenerateCorpus.cpp.o.d"
+  "GenerateCorpus"
+  "GenerateCorpus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GenerateCorpus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
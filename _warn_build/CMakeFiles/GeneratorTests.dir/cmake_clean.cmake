@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GeneratorTests.dir/tests/GeneratorTests.cpp.o"
+  "CMakeFiles/GeneratorTests.dir/tests/GeneratorTests.cpp.o.d"
+  "GeneratorTests"
+  "GeneratorTests.pdb"
+  "GeneratorTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GeneratorTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HtmlEscapeTests.dir/tests/HtmlEscapeTests.cpp.o"
+  "CMakeFiles/HtmlEscapeTests.dir/tests/HtmlEscapeTests.cpp.o.d"
+  "HtmlEscapeTests"
+  "HtmlEscapeTests.pdb"
+  "HtmlEscapeTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HtmlEscapeTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
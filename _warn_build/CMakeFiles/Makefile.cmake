@@ -0,0 +1,118 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-C.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-CXX.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.c"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.c"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/src/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/cmake/gmock.pc.in"
+  "/usr/src/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/usr/src/googletest/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googletest/cmake/Config.cmake.in"
+  "/usr/src/googletest/googletest/cmake/gtest.pc.in"
+  "/usr/src/googletest/googletest/cmake/gtest_main.pc.in"
+  "/usr/src/googletest/googletest/cmake/internal_utils.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/_CMakeLTOTest-CXX/src/CMakeLists.txt"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/foo.cpp"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/main.cpp"
+  "CMakeFiles/_CMakeLTOTest-C/src/CMakeLists.txt"
+  "CMakeFiles/_CMakeLTOTest-C/src/foo.c"
+  "CMakeFiles/_CMakeLTOTest-C/src/main.c"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/gmock.pc"
+  "_deps/googletest-build/googletest/generated/gmock_main.pc"
+  "_deps/googletest-build/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfigVersion.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfig.cmake"
+  "_deps/googletest-build/googletest/generated/gtest.pc"
+  "_deps/googletest-build/googletest/generated/gtest_main.pc"
+  "_deps/googletest-build/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/WebsiteGeneratorLib.dir/DependInfo.cmake"
+  "CMakeFiles/WebsiteGenerator.dir/DependInfo.cmake"
+  "CMakeFiles/WebsiteGeneratorRelease.dir/DependInfo.cmake"
+  "CMakeFiles/StartupBenchmark.dir/DependInfo.cmake"
+  "CMakeFiles/startup_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/WebsiteGeneratorHarness.dir/DependInfo.cmake"
+  "CMakeFiles/TranslatorScalingBenchmark.dir/DependInfo.cmake"
+  "CMakeFiles/TranslatorFuzzer.dir/DependInfo.cmake"
+  "CMakeFiles/GenerateCorpus.dir/DependInfo.cmake"
+  "CMakeFiles/FSEntryFinderTests.dir/DependInfo.cmake"
+  "CMakeFiles/FileSystemTests.dir/DependInfo.cmake"
+  "CMakeFiles/GeneratorTests.dir/DependInfo.cmake"
+  "CMakeFiles/HtmlEscapeTests.dir/DependInfo.cmake"
+  "CMakeFiles/PathTableTests.dir/DependInfo.cmake"
+  "CMakeFiles/PreviewServerTests.dir/DependInfo.cmake"
+  "CMakeFiles/RulesTests.dir/DependInfo.cmake"
+  "CMakeFiles/SchedulerTests.dir/DependInfo.cmake"
+  "CMakeFiles/ShardingTests.dir/DependInfo.cmake"
+  "CMakeFiles/TranslatorFuzzTests.dir/DependInfo.cmake"
+  "CMakeFiles/TranslatorTests.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PathTableTests.dir/tests/PathTableTests.cpp.o"
+  "CMakeFiles/PathTableTests.dir/tests/PathTableTests.cpp.o.d"
+  "PathTableTests"
+  "PathTableTests.pdb"
+  "PathTableTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PathTableTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
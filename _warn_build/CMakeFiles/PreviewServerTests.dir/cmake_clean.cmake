@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PreviewServerTests.dir/tests/PreviewServerTests.cpp.o"
+  "CMakeFiles/PreviewServerTests.dir/tests/PreviewServerTests.cpp.o.d"
+  "PreviewServerTests"
+  "PreviewServerTests.pdb"
+  "PreviewServerTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PreviewServerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RulesTests.dir/tests/RulesTests.cpp.o"
+  "CMakeFiles/RulesTests.dir/tests/RulesTests.cpp.o.d"
+  "RulesTests"
+  "RulesTests.pdb"
+  "RulesTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RulesTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SchedulerTests.dir/tests/SchedulerTests.cpp.o"
+  "CMakeFiles/SchedulerTests.dir/tests/SchedulerTests.cpp.o.d"
+  "SchedulerTests"
+  "SchedulerTests.pdb"
+  "SchedulerTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SchedulerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ShardingTests.dir/tests/ShardingTests.cpp.o"
+  "CMakeFiles/ShardingTests.dir/tests/ShardingTests.cpp.o.d"
+  "ShardingTests"
+  "ShardingTests.pdb"
+  "ShardingTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ShardingTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TranslatorFuzzTests.dir/tests/TranslatorFuzzTests.cpp.o"
+  "CMakeFiles/TranslatorFuzzTests.dir/tests/TranslatorFuzzTests.cpp.o.d"
+  "TranslatorFuzzTests"
+  "TranslatorFuzzTests.pdb"
+  "TranslatorFuzzTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TranslatorFuzzTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TranslatorFuzzer.dir/fuzz/StandaloneFuzzDriver.cpp.o"
+  "CMakeFiles/TranslatorFuzzer.dir/fuzz/StandaloneFuzzDriver.cpp.o.d"
+  "CMakeFiles/TranslatorFuzzer.dir/fuzz/TranslatorFuzzer.cpp.o"
+  "CMakeFiles/TranslatorFuzzer.dir/fuzz/TranslatorFuzzer.cpp.o.d"
+  "TranslatorFuzzer"
+  "TranslatorFuzzer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TranslatorFuzzer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TranslatorScalingBenchmark.dir/bench/TranslatorScalingBenchmark.cpp.o"
+  "CMakeFiles/TranslatorScalingBenchmark.dir/bench/TranslatorScalingBenchmark.cpp.o.d"
+  "TranslatorScalingBenchmark"
+  "TranslatorScalingBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TranslatorScalingBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
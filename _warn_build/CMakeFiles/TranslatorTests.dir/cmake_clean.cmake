@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TranslatorTests.dir/tests/TranslatorTests.cpp.o"
+  "CMakeFiles/TranslatorTests.dir/tests/TranslatorTests.cpp.o.d"
+  "TranslatorTests"
+  "TranslatorTests.pdb"
+  "TranslatorTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TranslatorTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
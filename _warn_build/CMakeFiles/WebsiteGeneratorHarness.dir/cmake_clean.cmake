@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/GemtextCorpus.cpp.o"
+  "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/GemtextCorpus.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/TranslatorHarness.cpp.o"
+  "CMakeFiles/WebsiteGeneratorHarness.dir/project/src/TranslatorHarness.cpp.o.d"
+  "libWebsiteGeneratorHarness.a"
+  "libWebsiteGeneratorHarness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WebsiteGeneratorHarness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
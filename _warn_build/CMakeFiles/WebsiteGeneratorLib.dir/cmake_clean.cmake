@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/FSEntryFinder.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/FSEntryFinder.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/FileSystem.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/FileSystem.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Generator.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Generator.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/HtmlEscape.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/HtmlEscape.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/PageCache.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/PageCache.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/PathTable.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/PathTable.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/PreviewServer.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/PreviewServer.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Rules.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Rules.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Scheduler.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Scheduler.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Sharding.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Sharding.cpp.o.d"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Translator.cpp.o"
+  "CMakeFiles/WebsiteGeneratorLib.dir/project/src/Translator.cpp.o.d"
+  "libWebsiteGeneratorLib.a"
+  "libWebsiteGeneratorLib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WebsiteGeneratorLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
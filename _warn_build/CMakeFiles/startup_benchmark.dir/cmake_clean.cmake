@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/startup_benchmark"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/startup_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_warn_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_warn_build/FSEntryFinderTests[1]_include.cmake")
+include("/root/repo/_warn_build/FileSystemTests[1]_include.cmake")
+include("/root/repo/_warn_build/GeneratorTests[1]_include.cmake")
+include("/root/repo/_warn_build/HtmlEscapeTests[1]_include.cmake")
+include("/root/repo/_warn_build/PathTableTests[1]_include.cmake")
+include("/root/repo/_warn_build/PreviewServerTests[1]_include.cmake")
+include("/root/repo/_warn_build/RulesTests[1]_include.cmake")
+include("/root/repo/_warn_build/SchedulerTests[1]_include.cmake")
+include("/root/repo/_warn_build/ShardingTests[1]_include.cmake")
+include("/root/repo/_warn_build/TranslatorFuzzTests[1]_include.cmake")
+include("/root/repo/_warn_build/TranslatorTests[1]_include.cmake")
+add_test(ShardedGeneration "/usr/bin/cmake" "-DGENERATOR=/root/repo/_warn_build/WebsiteGenerator" "-DSHARDS=4" "-DWORK_DIR=/root/repo/_warn_build/ShardedGeneration" "-P" "/root/repo/tests/ShardedGeneration.cmake")
+set_tests_properties(ShardedGeneration PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;194;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("_deps/googletest-build")
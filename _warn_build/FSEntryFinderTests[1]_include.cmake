@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/FSEntryFinderTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/FSEntryFinderTests[1]_tests.cmake")
+else()
+  add_test(FSEntryFinderTests_NOT_BUILT FSEntryFinderTests_NOT_BUILT)
+endif()
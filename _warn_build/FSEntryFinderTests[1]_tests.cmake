@@ -0,0 +1,9 @@
+add_test([=[RegDirFinderTests.ValidDirectory]=]  /root/repo/_warn_build/FSEntryFinderTests [==[--gtest_filter=RegDirFinderTests.ValidDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegDirFinderTests.ValidDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegDirFinderTests.NotExistDir]=]  /root/repo/_warn_build/FSEntryFinderTests [==[--gtest_filter=RegDirFinderTests.NotExistDir]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegDirFinderTests.NotExistDir]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegDirFinderTests.NotDirectory]=]  /root/repo/_warn_build/FSEntryFinderTests [==[--gtest_filter=RegDirFinderTests.NotDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegDirFinderTests.NotDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegDirFinderTests.DirectoryRecursiveTraverse]=]  /root/repo/_warn_build/FSEntryFinderTests [==[--gtest_filter=RegDirFinderTests.DirectoryRecursiveTraverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegDirFinderTests.DirectoryRecursiveTraverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  FSEntryFinderTests_TESTS RegDirFinderTests.ValidDirectory RegDirFinderTests.NotExistDir RegDirFinderTests.NotDirectory RegDirFinderTests.DirectoryRecursiveTraverse)
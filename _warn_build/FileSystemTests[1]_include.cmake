@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/FileSystemTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/FileSystemTests[1]_tests.cmake")
+else()
+  add_test(FileSystemTests_NOT_BUILT FileSystemTests_NOT_BUILT)
+endif()
@@ -0,0 +1,31 @@
+add_test([=[MemoryFileSystemTests.ParentDirectoriesCreated]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.ParentDirectoriesCreated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.ParentDirectoriesCreated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.WalkRecursive]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.WalkRecursive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.WalkRecursive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.WalkNotRecursive]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.WalkNotRecursive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.WalkNotRecursive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.WalkSkipSubtree]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.WalkSkipSubtree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.WalkSkipSubtree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.StreamsReadAndWrite]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.StreamsReadAndWrite]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.StreamsReadAndWrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.CopyTreeAndFiles]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.CopyTreeAndFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.CopyTreeAndFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.LargeFiles]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.LargeFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.LargeFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.VisitorUsesFileSystem]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.VisitorUsesFileSystem]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.VisitorUsesFileSystem]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.RemoveFile]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.RemoveFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.RemoveFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemTests.ReadAndWriteAll]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemTests.ReadAndWriteAll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemTests.ReadAndWriteAll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryFileSystemEmptyTests.EmptyFirstFile]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=MemoryFileSystemEmptyTests.EmptyFirstFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryFileSystemEmptyTests.EmptyFirstFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NativeFileSystemTests.ReadAllWithAnySizeHint]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=NativeFileSystemTests.ReadAllWithAnySizeHint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NativeFileSystemTests.ReadAllWithAnySizeHint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NativeFileSystemTests.DeferredWritesAreComplete]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=NativeFileSystemTests.DeferredWritesAreComplete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NativeFileSystemTests.DeferredWritesAreComplete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NativeFileSystemTests.DirectoryRelativeAccess]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=NativeFileSystemTests.DirectoryRelativeAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NativeFileSystemTests.DirectoryRelativeAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NativeFileSystemTests.WalkAndCopyTree]=]  /root/repo/_warn_build/FileSystemTests [==[--gtest_filter=NativeFileSystemTests.WalkAndCopyTree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NativeFileSystemTests.WalkAndCopyTree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  FileSystemTests_TESTS MemoryFileSystemTests.ParentDirectoriesCreated MemoryFileSystemTests.WalkRecursive MemoryFileSystemTests.WalkNotRecursive MemoryFileSystemTests.WalkSkipSubtree MemoryFileSystemTests.StreamsReadAndWrite MemoryFileSystemTests.CopyTreeAndFiles MemoryFileSystemTests.LargeFiles MemoryFileSystemTests.VisitorUsesFileSystem MemoryFileSystemTests.RemoveFile MemoryFileSystemTests.ReadAndWriteAll MemoryFileSystemEmptyTests.EmptyFirstFile NativeFileSystemTests.ReadAllWithAnySizeHint NativeFileSystemTests.DeferredWritesAreComplete NativeFileSystemTests.DirectoryRelativeAccess NativeFileSystemTests.WalkAndCopyTree)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/GeneratorTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/GeneratorTests[1]_tests.cmake")
+else()
+  add_test(GeneratorTests_NOT_BUILT GeneratorTests_NOT_BUILT)
+endif()
@@ -0,0 +1,17 @@
+add_test([=[GemtextGeneratorTests.GenerateValid]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=GemtextGeneratorTests.GenerateValid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GemtextGeneratorTests.GenerateValid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GemtextGeneratorTests.InvalidInput]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=GemtextGeneratorTests.InvalidInput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GemtextGeneratorTests.InvalidInput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GemtextGeneratorTests.InvalidOutput]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=GemtextGeneratorTests.InvalidOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GemtextGeneratorTests.InvalidOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryGeneratorTests.GenerateInMemory]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=MemoryGeneratorTests.GenerateInMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryGeneratorTests.GenerateInMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoryGeneratorTests.GenerateSyntheticTree]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=MemoryGeneratorTests.GenerateSyntheticTree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryGeneratorTests.GenerateSyntheticTree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallFileGeneratorTests.FastPathMatchesStreams]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=SmallFileGeneratorTests.FastPathMatchesStreams]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFileGeneratorTests.FastPathMatchesStreams]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallFileGeneratorTests.RelativeInputDirectory]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=SmallFileGeneratorTests.RelativeInputDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFileGeneratorTests.RelativeInputDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallFileGeneratorTests.FailedPageLeavesNoOutput]=]  /root/repo/_warn_build/GeneratorTests [==[--gtest_filter=SmallFileGeneratorTests.FailedPageLeavesNoOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFileGeneratorTests.FailedPageLeavesNoOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  GeneratorTests_TESTS GemtextGeneratorTests.GenerateValid GemtextGeneratorTests.InvalidInput GemtextGeneratorTests.InvalidOutput MemoryGeneratorTests.GenerateInMemory MemoryGeneratorTests.GenerateSyntheticTree SmallFileGeneratorTests.FastPathMatchesStreams SmallFileGeneratorTests.RelativeInputDirectory SmallFileGeneratorTests.FailedPageLeavesNoOutput)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/HtmlEscapeTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/HtmlEscapeTests[1]_tests.cmake")
+else()
+  add_test(HtmlEscapeTests_NOT_BUILT HtmlEscapeTests_NOT_BUILT)
+endif()
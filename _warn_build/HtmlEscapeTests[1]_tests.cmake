@@ -0,0 +1,11 @@
+add_test([=[HtmlEscapeTests.CleanTextUnchanged]=]  /root/repo/_warn_build/HtmlEscapeTests [==[--gtest_filter=HtmlEscapeTests.CleanTextUnchanged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HtmlEscapeTests.CleanTextUnchanged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HtmlEscapeTests.TextContext]=]  /root/repo/_warn_build/HtmlEscapeTests [==[--gtest_filter=HtmlEscapeTests.TextContext]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HtmlEscapeTests.TextContext]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HtmlEscapeTests.AttributeContext]=]  /root/repo/_warn_build/HtmlEscapeTests [==[--gtest_filter=HtmlEscapeTests.AttributeContext]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HtmlEscapeTests.AttributeContext]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HtmlEscapeTests.CharactersAtChunkBoundaries]=]  /root/repo/_warn_build/HtmlEscapeTests [==[--gtest_filter=HtmlEscapeTests.CharactersAtChunkBoundaries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HtmlEscapeTests.CharactersAtChunkBoundaries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HtmlEscapeTests.MatchesScalarReference]=]  /root/repo/_warn_build/HtmlEscapeTests [==[--gtest_filter=HtmlEscapeTests.MatchesScalarReference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HtmlEscapeTests.MatchesScalarReference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  HtmlEscapeTests_TESTS HtmlEscapeTests.CleanTextUnchanged HtmlEscapeTests.TextContext HtmlEscapeTests.AttributeContext HtmlEscapeTests.CharactersAtChunkBoundaries HtmlEscapeTests.MatchesScalarReference)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/PathTableTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/PathTableTests[1]_tests.cmake")
+else()
+  add_test(PathTableTests_NOT_BUILT PathTableTests_NOT_BUILT)
+endif()
@@ -0,0 +1,15 @@
+add_test([=[PathTableTests.OrderMatchesPathSet]=]  /root/repo/_warn_build/PathTableTests [==[--gtest_filter=PathTableTests.OrderMatchesPathSet]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathTableTests.OrderMatchesPathSet]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathTableTests.DuplicatesIgnored]=]  /root/repo/_warn_build/PathTableTests [==[--gtest_filter=PathTableTests.DuplicatesIgnored]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathTableTests.DuplicatesIgnored]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathTableTests.FileAndDirectoryConflictsRejected]=]  /root/repo/_warn_build/PathTableTests [==[--gtest_filter=PathTableTests.FileAndDirectoryConflictsRejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathTableTests.FileAndDirectoryConflictsRejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathTableTests.RelativeToRoot]=]  /root/repo/_warn_build/PathTableTests [==[--gtest_filter=PathTableTests.RelativeToRoot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathTableTests.RelativeToRoot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathTableTests.DirectoriesInterned]=]  /root/repo/_warn_build/PathTableTests [==[--gtest_filter=PathTableTests.DirectoriesInterned]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathTableTests.DirectoriesInterned]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathTableTests.AbsolutePaths]=]  /root/repo/_warn_build/PathTableTests [==[--gtest_filter=PathTableTests.AbsolutePaths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathTableTests.AbsolutePaths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathTableTests.EqualityDependsOnRoot]=]  /root/repo/_warn_build/PathTableTests [==[--gtest_filter=PathTableTests.EqualityDependsOnRoot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathTableTests.EqualityDependsOnRoot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  PathTableTests_TESTS PathTableTests.OrderMatchesPathSet PathTableTests.DuplicatesIgnored PathTableTests.FileAndDirectoryConflictsRejected PathTableTests.RelativeToRoot PathTableTests.DirectoriesInterned PathTableTests.AbsolutePaths PathTableTests.EqualityDependsOnRoot)
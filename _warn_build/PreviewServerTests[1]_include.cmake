@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/PreviewServerTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/PreviewServerTests[1]_tests.cmake")
+else()
+  add_test(PreviewServerTests_NOT_BUILT PreviewServerTests_NOT_BUILT)
+endif()
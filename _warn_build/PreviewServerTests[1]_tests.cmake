@@ -0,0 +1,31 @@
+add_test([=[PageCacheTests.GetReturnsPutPage]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PageCacheTests.GetReturnsPutPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageCacheTests.GetReturnsPutPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageCacheTests.ModifiedPageIsMissing]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PageCacheTests.ModifiedPageIsMissing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageCacheTests.ModifiedPageIsMissing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageCacheTests.LeastRecentlyUsedPageIsEvicted]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PageCacheTests.LeastRecentlyUsedPageIsEvicted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageCacheTests.LeastRecentlyUsedPageIsEvicted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageCacheTests.TooLargePageIsNotCached]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PageCacheTests.TooLargePageIsNotCached]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageCacheTests.TooLargePageIsNotCached]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.PageIsTranslated]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.PageIsTranslated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.PageIsTranslated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.DirectoryIndexIsTranslated]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.DirectoryIndexIsTranslated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.DirectoryIndexIsTranslated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.RedirectKeepsTargetEncoded]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.RedirectKeepsTargetEncoded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.RedirectKeepsTargetEncoded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.ModifiedPageIsTranslatedAgain]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.ModifiedPageIsTranslatedAgain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.ModifiedPageIsTranslatedAgain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.AssetIsSent]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.AssetIsSent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.AssetIsSent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.HeadHasNoBody]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.HeadHasNoBody]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.HeadHasNoBody]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.InvalidRequests]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.InvalidRequests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.InvalidRequests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.SymbolicLinksDoNotLeaveRoot]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.SymbolicLinksDoNotLeaveRoot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.SymbolicLinksDoNotLeaveRoot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.KeepAliveConnectionServesSeveralRequests]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.KeepAliveConnectionServesSeveralRequests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.KeepAliveConnectionServesSeveralRequests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.ParallelClients]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.ParallelClients]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.ParallelClients]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreviewServerTests.StopDoesNotWaitForIncompleteRequests]=]  /root/repo/_warn_build/PreviewServerTests [==[--gtest_filter=PreviewServerTests.StopDoesNotWaitForIncompleteRequests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreviewServerTests.StopDoesNotWaitForIncompleteRequests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  PreviewServerTests_TESTS PageCacheTests.GetReturnsPutPage PageCacheTests.ModifiedPageIsMissing PageCacheTests.LeastRecentlyUsedPageIsEvicted PageCacheTests.TooLargePageIsNotCached PreviewServerTests.PageIsTranslated PreviewServerTests.DirectoryIndexIsTranslated PreviewServerTests.RedirectKeepsTargetEncoded PreviewServerTests.ModifiedPageIsTranslatedAgain PreviewServerTests.AssetIsSent PreviewServerTests.HeadHasNoBody PreviewServerTests.InvalidRequests PreviewServerTests.SymbolicLinksDoNotLeaveRoot PreviewServerTests.KeepAliveConnectionServesSeveralRequests PreviewServerTests.ParallelClients PreviewServerTests.StopDoesNotWaitForIncompleteRequests)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/RulesTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/RulesTests[1]_tests.cmake")
+else()
+  add_test(RulesTests_NOT_BUILT RulesTests_NOT_BUILT)
+endif()
@@ -0,0 +1,31 @@
+add_test([=[GlobPatternTests.StarDoesNotCrossDirectories]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=GlobPatternTests.StarDoesNotCrossDirectories]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlobPatternTests.StarDoesNotCrossDirectories]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlobPatternTests.BasenamePattern]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=GlobPatternTests.BasenamePattern]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlobPatternTests.BasenamePattern]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlobPatternTests.DoubleStar]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=GlobPatternTests.DoubleStar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlobPatternTests.DoubleStar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlobPatternTests.CharacterClasses]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=GlobPatternTests.CharacterClasses]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlobPatternTests.CharacterClasses]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlobPatternTests.MayMatchBeneath]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=GlobPatternTests.MayMatchBeneath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlobPatternTests.MayMatchBeneath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlobPatternTests.AdjacentStars]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=GlobPatternTests.AdjacentStars]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlobPatternTests.AdjacentStars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlobPatternTests.InvalidPattern]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=GlobPatternTests.InvalidPattern]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlobPatternTests.InvalidPattern]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.ParseInvalid]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.ParseInvalid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.ParseInvalid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.LoadNotExistFile]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.LoadNotExistFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.LoadNotExistFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.LastIncludeExcludeWins]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.LastIncludeExcludeWins]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.LastIncludeExcludeWins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.ExcludedDirectoryExcludesFiles]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.ExcludedDirectoryExcludesFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.ExcludedDirectoryExcludesFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.IncludeBeneathExcludedDirectory]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.IncludeBeneathExcludedDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.IncludeBeneathExcludedDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.FinderPrunesExcludedSubtree]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.FinderPrunesExcludedSubtree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.FinderPrunesExcludedSubtree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.GeneratorRoutesBySkipAndTranslateRules]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.GeneratorRoutesBySkipAndTranslateRules]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.GeneratorRoutesBySkipAndTranslateRules]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RuleSetTests.GeneratorUnknownTranslator]=]  /root/repo/_warn_build/RulesTests [==[--gtest_filter=RuleSetTests.GeneratorUnknownTranslator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RuleSetTests.GeneratorUnknownTranslator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  RulesTests_TESTS GlobPatternTests.StarDoesNotCrossDirectories GlobPatternTests.BasenamePattern GlobPatternTests.DoubleStar GlobPatternTests.CharacterClasses GlobPatternTests.MayMatchBeneath GlobPatternTests.AdjacentStars GlobPatternTests.InvalidPattern RuleSetTests.ParseInvalid RuleSetTests.LoadNotExistFile RuleSetTests.LastIncludeExcludeWins RuleSetTests.ExcludedDirectoryExcludesFiles RuleSetTests.IncludeBeneathExcludedDirectory RuleSetTests.FinderPrunesExcludedSubtree RuleSetTests.GeneratorRoutesBySkipAndTranslateRules RuleSetTests.GeneratorUnknownTranslator)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/SchedulerTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/SchedulerTests[1]_tests.cmake")
+else()
+  add_test(SchedulerTests_NOT_BUILT SchedulerTests_NOT_BUILT)
+endif()
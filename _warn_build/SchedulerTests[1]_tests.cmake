@@ -0,0 +1,11 @@
+add_test([=[SchedulerTests.LargestJobsFirst]=]  /root/repo/_warn_build/SchedulerTests [==[--gtest_filter=SchedulerTests.LargestJobsFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SchedulerTests.LargestJobsFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SchedulerTests.IoLimitedPerDevice]=]  /root/repo/_warn_build/SchedulerTests [==[--gtest_filter=SchedulerTests.IoLimitedPerDevice]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SchedulerTests.IoLimitedPerDevice]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SchedulerTests.ExceptionRethrown]=]  /root/repo/_warn_build/SchedulerTests [==[--gtest_filter=SchedulerTests.ExceptionRethrown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SchedulerTests.ExceptionRethrown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SchedulerTests.SmallRunOnCallingThread]=]  /root/repo/_warn_build/SchedulerTests [==[--gtest_filter=SchedulerTests.SmallRunOnCallingThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SchedulerTests.SmallRunOnCallingThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SchedulerTests.ZeroIoPerDeviceIsClamped]=]  /root/repo/_warn_build/SchedulerTests [==[--gtest_filter=SchedulerTests.ZeroIoPerDeviceIsClamped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SchedulerTests.ZeroIoPerDeviceIsClamped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  SchedulerTests_TESTS SchedulerTests.LargestJobsFirst SchedulerTests.IoLimitedPerDevice SchedulerTests.ExceptionRethrown SchedulerTests.SmallRunOnCallingThread SchedulerTests.ZeroIoPerDeviceIsClamped)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/ShardingTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/ShardingTests[1]_tests.cmake")
+else()
+  add_test(ShardingTests_NOT_BUILT ShardingTests_NOT_BUILT)
+endif()
@@ -0,0 +1,19 @@
+add_test([=[ShardingTests.ParseValid]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.ParseValid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.ParseValid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.ParseInvalid]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.ParseInvalid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.ParseInvalid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.PartitionDisjointAndComplete]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.PartitionDisjointAndComplete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.PartitionDisjointAndComplete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.DirectoryAffinity]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.DirectoryAffinity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.DirectoryAffinity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.StableHash]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.StableHash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.StableHash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.ShardedGenerationMatchesSingle]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.ShardedGenerationMatchesSingle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.ShardedGenerationMatchesSingle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.SingleShardWritesManifest]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.SingleShardWritesManifest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.SingleShardWritesManifest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.MergeMissingManifest]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.MergeMissingManifest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.MergeMissingManifest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardingTests.MergeThroughFileSystem]=]  /root/repo/_warn_build/ShardingTests [==[--gtest_filter=ShardingTests.MergeThroughFileSystem]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardingTests.MergeThroughFileSystem]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  ShardingTests_TESTS ShardingTests.ParseValid ShardingTests.ParseInvalid ShardingTests.PartitionDisjointAndComplete ShardingTests.DirectoryAffinity ShardingTests.StableHash ShardingTests.ShardedGenerationMatchesSingle ShardingTests.SingleShardWritesManifest ShardingTests.MergeMissingManifest ShardingTests.MergeThroughFileSystem)
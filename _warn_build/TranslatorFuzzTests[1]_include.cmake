@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/TranslatorFuzzTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/TranslatorFuzzTests[1]_tests.cmake")
+else()
+  add_test(TranslatorFuzzTests_NOT_BUILT TranslatorFuzzTests_NOT_BUILT)
+endif()
@@ -0,0 +1,9 @@
+add_test([=[TranslatorFuzzTests.ReferenceMatchesHandcraftedCase]=]  /root/repo/_warn_build/TranslatorFuzzTests [==[--gtest_filter=TranslatorFuzzTests.ReferenceMatchesHandcraftedCase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorFuzzTests.ReferenceMatchesHandcraftedCase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorFuzzTests.EdgeCases]=]  /root/repo/_warn_build/TranslatorFuzzTests [==[--gtest_filter=TranslatorFuzzTests.EdgeCases]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorFuzzTests.EdgeCases]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorFuzzTests.GeneratedCorpus]=]  /root/repo/_warn_build/TranslatorFuzzTests [==[--gtest_filter=TranslatorFuzzTests.GeneratedCorpus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorFuzzTests.GeneratedCorpus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorFuzzTests.PathologicalDocuments]=]  /root/repo/_warn_build/TranslatorFuzzTests [==[--gtest_filter=TranslatorFuzzTests.PathologicalDocuments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorFuzzTests.PathologicalDocuments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  TranslatorFuzzTests_TESTS TranslatorFuzzTests.ReferenceMatchesHandcraftedCase TranslatorFuzzTests.EdgeCases TranslatorFuzzTests.GeneratedCorpus TranslatorFuzzTests.PathologicalDocuments)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/TranslatorTests[1]_tests.cmake")
+  include("/root/repo/_warn_build/TranslatorTests[1]_tests.cmake")
+else()
+  add_test(TranslatorTests_NOT_BUILT TranslatorTests_NOT_BUILT)
+endif()
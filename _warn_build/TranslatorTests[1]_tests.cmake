@@ -0,0 +1,19 @@
+add_test([=[TranslatorTests.DefaultTranslate]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.DefaultTranslate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.DefaultTranslate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorTranslate]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorTranslate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorTranslate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorInvalidBlockquote]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorInvalidBlockquote]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorInvalidBlockquote]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorInvalidHeaderEmpty]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorInvalidHeaderEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorInvalidHeaderEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorInvalidLink]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorInvalidLink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorInvalidLink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorInvalidPreformed]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorInvalidPreformed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorInvalidPreformed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorInvalidList]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorInvalidList]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorInvalidList]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorListEnds]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorListEnds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorListEnds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TranslatorTests.GemToHTMLTranslatorEscaping]=]  /root/repo/_warn_build/TranslatorTests [==[--gtest_filter=TranslatorTests.GemToHTMLTranslatorEscaping]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TranslatorTests.GemToHTMLTranslatorEscaping]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  TranslatorTests_TESTS TranslatorTests.DefaultTranslate TranslatorTests.GemToHTMLTranslatorTranslate TranslatorTests.GemToHTMLTranslatorInvalidBlockquote TranslatorTests.GemToHTMLTranslatorInvalidHeaderEmpty TranslatorTests.GemToHTMLTranslatorInvalidLink TranslatorTests.GemToHTMLTranslatorInvalidPreformed TranslatorTests.GemToHTMLTranslatorInvalidList TranslatorTests.GemToHTMLTranslatorListEnds TranslatorTests.GemToHTMLTranslatorEscaping)
@@ -0,0 +1,122 @@
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr size_t DEFAULT_RUNS = 200;
+    // Goal for the user time of a short run, that 90% of runs should meet.
+    constexpr double TARGET_USER_US = 1000;
+
+    struct Sample {
+        double user_us;
+        double system_us;
+        double wall_us;
+    };
+
+    struct Distribution {
+        double mean;
+        double median;
+        double p90;
+    };
+
+    double Microseconds(const timeval &time) { return static_cast<double>(time.tv_sec) * 1e6 + time.tv_usec; }
+
+    /**
+     * Runs generator as a separate process, so dynamic loading, static initialization and
+     * thread startup are measured together with the generation itself.
+     */
+    bool RunOnce(const std::string &generator, const std::string &input, const fs::path &output, Sample &sample) {
+        fs::remove_all(output);
+        fs::create_directories(output);
+
+        const auto start = std::chrono::steady_clock::now();
+        const pid_t pid = fork();
+        if (pid < 0) {
+            return false;
+        }
+        if (pid == 0) {
+            const int null = open("/dev/null", O_WRONLY);
+            dup2(null, STDOUT_FILENO);
+            dup2(null, STDERR_FILENO);
+            execl(generator.c_str(), generator.c_str(), input.c_str(), output.c_str(), static_cast<char *>(nullptr));
+            _exit(EXIT_FAILURE);
+        }
+
+        int status = 0;
+        rusage usage{};
+        if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+            return false;
+        }
+        sample.wall_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        sample.user_us = Microseconds(usage.ru_utime);
+        sample.system_us = Microseconds(usage.ru_stime);
+        return true;
+    }
+
+    /**
+     * CPU times may be accounted by scheduler ticks, so a single run reads as either 0 or a whole tick.
+     * Mean of many runs is still accurate, so it is reported along with the distribution.
+     */
+    template <typename Field>
+    Distribution Report(const char *name, std::vector<Sample> &samples, Field field) {
+        std::sort(samples.begin(), samples.end(),
+                  [field](const Sample &lhs, const Sample &rhs) { return lhs.*field < rhs.*field; });
+        double sum = 0;
+        for (const auto &sample : samples) {
+            sum += sample.*field;
+        }
+        const Distribution distribution{sum / samples.size(), samples[samples.size() / 2].*field,
+                                        samples[samples.size() * 9 / 10].*field};
+        std::cout << name << ": mean " << distribution.mean << " us, median " << distribution.median << " us, p90 "
+                  << distribution.p90 << " us\n";
+        return distribution;
+    }
+}  // namespace
+
+/**
+ * Measures cost of short generator invocations.
+ * Usage: StartupBenchmark <generator_binary> <input_dir> [runs]
+ */
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: StartupBenchmark <generator_binary> <input_dir> [runs]\n";
+        return EXIT_FAILURE;
+    }
+    const size_t runs = argc > 3 ? std::stoul(argv[3]) : DEFAULT_RUNS;
+    const fs::path output = fs::temp_directory_path() / ("StartupBenchmark-" + std::to_string(getpid()));
+
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < runs; ++i) {
+        Sample sample{};
+        if (!RunOnce(argv[1], argv[2], output, sample)) {
+            std::cerr << "Generator failed\n";
+            fs::remove_all(output);
+            return EXIT_FAILURE;
+        }
+        samples.push_back(sample);
+    }
+    fs::remove_all(output);
+
+    std::cout << "Runs: " << runs << '\n';
+    const Distribution user = Report("user", samples, &Sample::user_us);
+    Report("system", samples, &Sample::system_us);
+    Report("wall", samples, &Sample::wall_us);
+    if (user.p90 < TARGET_USER_US) {
+        std::cout << "Target of " << TARGET_USER_US << " us user time at p90 is met\n";
+    } else {
+        std::cout << "Target of " << TARGET_USER_US << " us user time at p90 is MISSED by "
+                  << user.p90 - TARGET_USER_US << " us\n";
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,38 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+#include "GemtextCorpus.hpp"
+#include "TranslatorHarness.hpp"
+
+namespace {
+    constexpr size_t PATHOLOGICAL_DOCUMENT_SIZE = 1 << 16;
+    constexpr size_t SCALING_FACTOR = 8;
+    // Linear translation gives the ratio about 1, quadratic one gives about SCALING_FACTOR.
+    constexpr double MAX_SCALING_RATIO = 3.0;
+    // A single measurement may be inflated by other processes, so the best of several is taken.
+    constexpr size_t ATTEMPTS = 3;
+}  // namespace
+
+/**
+ * Checks, that translation time of pathological documents grows linearly with their size.
+ * Wall clock ratios depend on the host load, so the check is a benchmark, not a unit test.
+ */
+int main() {
+    int status = EXIT_SUCCESS;
+    size_t index = 0;
+    for (const auto &document : generator::GemtextCorpusGenerator::PathologicalDocuments(PATHOLOGICAL_DOCUMENT_SIZE)) {
+        double ratio = std::numeric_limits<double>::max();
+        for (size_t attempt = 0; attempt < ATTEMPTS && ratio >= MAX_SCALING_RATIO; ++attempt) {
+            ratio = std::min(ratio, generator::TranslationScaling(document, SCALING_FACTOR));
+        }
+        const bool linear = ratio < MAX_SCALING_RATIO;
+        std::cout << "Document " << index << ": ratio " << ratio << (linear ? "" : " (superlinear)") << '\n';
+        if (!linear) {
+            status = EXIT_FAILURE;
+        }
+        ++index;
+    }
+    return status;
+}
@@ -0,0 +1,39 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "GemtextCorpus.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr size_t MAX_DOCUMENT_LINES = 64;
+    constexpr size_t PATHOLOGICAL_DOCUMENT_SIZE = 4096;
+}  // namespace
+
+/**
+ * Writes seed corpus for the translator fuzzer: structured random documents and pathological ones.
+ * Usage: GenerateCorpus <output_dir> [documents] [seed]
+ */
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: GenerateCorpus <output_dir> [documents] [seed]\n";
+        return EXIT_FAILURE;
+    }
+    const fs::path output = argv[1];
+    const size_t documents = argc > 2 ? std::stoul(argv[2]) : 256;
+    const uint64_t seed = argc > 3 ? std::stoull(argv[3]) : 0;
+    fs::create_directories(output);
+
+    generator::GemtextCorpusGenerator corpus(seed);
+    for (size_t i = 0; i < documents; ++i) {
+        std::ofstream(output / ("random-" + std::to_string(i) + ".gmi")) << corpus.Document(1 + i % MAX_DOCUMENT_LINES);
+    }
+    size_t index = 0;
+    for (const auto &document : generator::GemtextCorpusGenerator::PathologicalDocuments(PATHOLOGICAL_DOCUMENT_SIZE)) {
+        std::ofstream(output / ("pathological-" + std::to_string(index++) + ".gmi")) << document;
+    }
+    return EXIT_SUCCESS;
+}
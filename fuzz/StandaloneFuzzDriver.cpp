@@ -0,0 +1,42 @@
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+namespace fs = std::filesystem;
+
+namespace {
+    void RunFile(const fs::path &path) {
+        std::ifstream is(path, std::ios::binary);
+        const std::string input{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+        LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t *>(input.data()), input.size());
+    }
+}  // namespace
+
+/**
+ * Replays corpus files and directories through the fuzzing entry point. It is used instead
+ * of libFuzzer by compilers, that do not support it, and to reproduce crashes.
+ */
+int main(int argc, char *argv[]) {
+    size_t inputs = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (fs::is_directory(argv[i])) {
+            for (const auto &entry : fs::recursive_directory_iterator(argv[i])) {
+                if (entry.is_regular_file()) {
+                    RunFile(entry.path());
+                    ++inputs;
+                }
+            }
+        } else {
+            RunFile(argv[i]);
+            ++inputs;
+        }
+    }
+    std::cerr << "Executed " << inputs << " inputs\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,37 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+#include "TranslatorHarness.hpp"
+
+namespace {
+    // Inputs smaller than this are translated too fast for the time to be measured reliably.
+    constexpr size_t MIN_SCALING_INPUT_SIZE = 1024;
+    constexpr size_t SCALING_FACTOR = 8;
+    // Linear translation gives the ratio about 1, quadratic one gives about SCALING_FACTOR.
+    constexpr double MAX_SCALING_RATIO = 3.0;
+}  // namespace
+
+/**
+ * Fuzzing entry point. Every input is translated by all translation paths, that are compared
+ * with the reference implementation, and large inputs are checked for superlinear translation time.
+ */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    const std::string_view input(reinterpret_cast<const char *>(data), size);
+    const auto report = generator::CheckTranslation(input);
+    if (!report.consistent) {
+        std::cerr << report.mismatch << '\n';
+        std::abort();
+    }
+
+    if (size >= MIN_SCALING_INPUT_SIZE) {
+        const double ratio = generator::TranslationScaling(input, SCALING_FACTOR);
+        if (ratio > MAX_SCALING_RATIO) {
+            std::cerr << "Translation time grows superlinearly: ratio " << ratio << " for input of " << size
+                      << " bytes\n";
+            std::abort();
+        }
+    }
+    return 0;
+}
@@ -4,11 +4,15 @@
 #include <exception>
 #include <filesystem>
 #include <memory>
-#include <set>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include "FileSystem.hpp"
+#include "PathTable.hpp"
+#include "Rules.hpp"
+
 namespace ffinder {
     namespace fs = std::filesystem;
     using PathType = fs::path;
@@ -16,6 +20,11 @@ namespace ffinder {
     bool IsRegular(const PathType &file);
     bool IsDirectory(const PathType &file);
 
+    /**
+     * @return Identifier of the device, that contains the file, or 0 if it is unknown.
+     */
+    DeviceIdType DeviceOf(const PathType &file);
+
     namespace exceptions {
         class FinderException : std::exception {
          public:
@@ -34,7 +43,7 @@ namespace ffinder {
     }  // namespace exceptions
 
     using FileType = PathType;
-    using FSEntityList = std::set<FileType>;
+    using FSEntityList = PathTable;
 
     /**
      * Basic class, that provides an interface for creating classes that return a list of
@@ -43,7 +52,8 @@ namespace ffinder {
      * @tparam Iter type of directory iterator.
      *
      * @note In fact, Iter should be std::filesystem::directory_iterator or
-     * std::filesystem::recursive::directory_iterator.
+     * std::filesystem::recursive::directory_iterator. It defines whether subdirectories are
+     * searched, the directory itself is walked through the finder's filesystem.
      */
     template <typename Iter>
     class BasicFSFinder {
@@ -51,11 +61,15 @@ namespace ffinder {
         using IteratorType = Iter;
         using FSFinderShPtr = std::shared_ptr<BasicFSFinder>;
         using FSFinderWkPtr = std::weak_ptr<BasicFSFinder>;
+        using FileSystemShPtr = BasicFileSystem::FileSystemShPtr;
 
         static constexpr std::string_view DefaultPath = ".";
+        static constexpr bool IsRecursive = std::is_same_v<Iter, fs::recursive_directory_iterator>;
 
         BasicFSFinder() = default;
 
+        explicit BasicFSFinder(const FileSystemShPtr &file_system) : m_file_system(file_system) {}
+
         virtual ~BasicFSFinder() = default;
 
         /**
@@ -67,16 +81,21 @@ namespace ffinder {
          * @note CreateFilesList associated with File structure, so it return the list of ones.
          */
         virtual FSEntityList CreateFilesList(const PathType &dir_name) const = 0;
-        static void CheckExistence(const PathType &dir_name);
+        void CheckExistence(const PathType &dir_name) const;
+
+        const BasicFileSystem &FileSystem() const { return *m_file_system; }
+
+     private:
+        FileSystemShPtr m_file_system = NativeFileSystem::Instance();
     };
 
     template <typename Iter>
-    void BasicFSFinder<Iter>::CheckExistence(const PathType &dir_name) {
-        if (!fs::exists(dir_name)) {
+    void BasicFSFinder<Iter>::CheckExistence(const PathType &dir_name) const {
+        if (!FileSystem().Exists(dir_name)) {
             throw exceptions::DirectoryNotFound();
         }
 
-        if (!fs::is_directory(dir_name)) {
+        if (!FileSystem().IsDirectory(dir_name)) {
             throw exceptions::NotDirectory();
         }
     }
@@ -92,6 +111,9 @@ namespace ffinder {
 
         RegularBasicFSFinder() = default;
 
+        explicit RegularBasicFSFinder(const typename BasicFSFinder<Iter>::FileSystemShPtr &file_system)
+            : BasicFSFinder<Iter>(file_system) {}
+
         /**
          * Ensures that it returns a list consisting of only regular files and directories.
          * @return List of
@@ -101,21 +123,63 @@ namespace ffinder {
 
     template <typename Iter>
     FSEntityList RegularBasicFSFinder<Iter>::CreateFilesList(const PathType &dir_name) const {
-        BasicFSFinder<Iter>::CheckExistence(dir_name);
-        FSEntityList regular_files_list;
+        using WalkAction = BasicFileSystem::WalkAction;
+        this->CheckExistence(dir_name);
+        FSEntityList regular_files_list(dir_name);
         // Iterate over directory and find all regular files and directories.
-        for (const auto &path_entry : IteratorType{dir_name}) {
-            if (IsRegular(path_entry)) {
-                //                regular_files_list.emplace(fs::absolute(path_entry));
-                regular_files_list.emplace(path_entry);
+        this->FileSystem().Walk(dir_name, this->IsRecursive, [&regular_files_list](const auto &entry) {
+            if (!entry.is_directory) {
+                regular_files_list.EmplaceRelative(entry.relative, entry.size);
             }
-        }
+            return WalkAction::Continue;
+        });
         return regular_files_list;
     }
 
     using RegualrFileFinder = RegularBasicFSFinder<fs::directory_iterator>;
     using RRegularFileFinder = RegularBasicFSFinder<fs::recursive_directory_iterator>;
 
+    /**
+     * Finder of regular files, that applies include and exclude rules during the scan.
+     * Excluded directories are pruned, so their subtrees are never enumerated.
+     */
+    template <typename Iter>
+    class FilteredBasicFSFinder : public BasicFSFinder<Iter> {
+     public:
+        using IteratorType = Iter;
+
+        explicit FilteredBasicFSFinder(const RuleSet::RuleSetShPtr &rules) : m_rules(rules) {}
+
+        FilteredBasicFSFinder(const RuleSet::RuleSetShPtr &rules,
+                              const typename BasicFSFinder<Iter>::FileSystemShPtr &file_system)
+            : BasicFSFinder<Iter>(file_system), m_rules(rules) {}
+
+        FSEntityList CreateFilesList(const PathType &dir_name) const override;
+
+     private:
+        RuleSet::RuleSetShPtr m_rules;
+    };
+
+    template <typename Iter>
+    FSEntityList FilteredBasicFSFinder<Iter>::CreateFilesList(const PathType &dir_name) const {
+        using WalkAction = BasicFileSystem::WalkAction;
+        this->CheckExistence(dir_name);
+        FSEntityList regular_files_list(dir_name);
+        this->FileSystem().Walk(dir_name, this->IsRecursive, [this, &regular_files_list](const auto &entry) {
+            if (entry.is_directory) {
+                return m_rules->IsExcluded(entry.relative, true) ? WalkAction::SkipSubtree : WalkAction::Continue;
+            }
+            if (!m_rules->IsExcluded(entry.relative, false)) {
+                regular_files_list.EmplaceRelative(entry.relative, entry.size);
+            }
+            return WalkAction::Continue;
+        });
+        return regular_files_list;
+    }
+
+    using FilteredFileFinder = FilteredBasicFSFinder<fs::directory_iterator>;
+    using RFilteredFileFinder = FilteredBasicFSFinder<fs::recursive_directory_iterator>;
+
     /**
      * Creates a pointer to finder specified object.
      * @tparam FinderType Finder type.
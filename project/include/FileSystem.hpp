@@ -0,0 +1,254 @@
+#ifndef PROJECT_INCLUDE_FILESYSTEM_HPP_
+#define PROJECT_INCLUDE_FILESYSTEM_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ffinder {
+    using PathType = std::filesystem::path;
+    using DeviceIdType = uint64_t;
+
+    /**
+     * Interface of the filesystem, that is used by finders and generators. It allows to generate
+     * sites not only from real directories, but also from trees, that are built in memory.
+     */
+    class BasicFileSystem {
+     public:
+        using FileSystemShPtr = std::shared_ptr<BasicFileSystem>;
+        using IStreamPtr = std::unique_ptr<std::istream>;
+        using OStreamPtr = std::unique_ptr<std::ostream>;
+
+        struct WalkEntry {
+            std::string_view relative;  // path relative to the walk root with '/' separators
+            bool is_directory;
+            uintmax_t size;
+        };
+
+        enum class WalkAction { Continue, SkipSubtree };
+        using WalkVisitor = std::function<WalkAction(const WalkEntry &)>;
+
+        /**
+         * Directory, whose files are accessed by names relative to it. Filesystems may keep it open,
+         * so the path is not resolved again for every file.
+         */
+        class Directory {
+         public:
+            explicit Directory(PathType path) : m_path(std::move(path)) {}
+            virtual ~Directory() = default;
+
+            const PathType &Path() const { return m_path; }
+
+         private:
+            PathType m_path;
+        };
+
+        using DirectoryShPtr = std::shared_ptr<const Directory>;
+
+        virtual ~BasicFileSystem() = default;
+
+        virtual bool Exists(const PathType &path) const = 0;
+        virtual bool IsDirectory(const PathType &path) const = 0;
+
+        /**
+         * Visits regular files and directories of the root. Symbolic links are not visited.
+         * @param recursive Whether subdirectories should be visited.
+         * @param visitor Callback, that can prune directory by returning WalkAction::SkipSubtree.
+         */
+        virtual void Walk(const PathType &root, bool recursive, const WalkVisitor &visitor) const = 0;
+
+        virtual void CreateDirectories(const PathType &path) = 0;
+
+        /**
+         * Recreates directory structure of the source directory without files.
+         */
+        virtual void CopyDirectoryTree(const PathType &from, const PathType &to) = 0;
+
+        virtual void CopyFile(const PathType &from, const PathType &to) = 0;
+
+        /**
+         * @return false if there is no such file.
+         */
+        virtual bool RemoveFile(const PathType &path) = 0;
+
+        /**
+         * @return Stream or nullptr, if file can not be opened.
+         */
+        virtual IStreamPtr OpenRead(const PathType &path) const = 0;
+        virtual OStreamPtr OpenWrite(const PathType &path) = 0;
+
+        /**
+         * Reads the whole file into the buffer, capacity of the buffer is reused.
+         * Default implementation reads the file stream.
+         * @param size_hint Expected size of the file, e. g. found by the finder.
+         * @return false if file can not be opened.
+         */
+        virtual bool ReadAll(const PathType &path, uintmax_t size_hint, std::string &content) const;
+
+        /**
+         * Creates or truncates the file and writes the content to it.
+         * Default implementation writes the file stream.
+         * @param defer_close Whether closing of the file may be postponed until FlushDeferred.
+         * @return false if file can not be written.
+         */
+        virtual bool WriteAll(const PathType &path, std::string_view content, bool defer_close = false);
+
+        /**
+         * Default implementation only remembers the path, files are accessed by full paths.
+         * @return Directory handle, never nullptr. Missing directory is reported by file operations.
+         */
+        virtual DirectoryShPtr OpenDirectory(const PathType &path) const;
+
+        /**
+         * Same as ReadAll and WriteAll for the file with the name relative to the directory.
+         */
+        virtual bool ReadAllAt(const Directory &directory, const PathType &name, uintmax_t size_hint,
+                               std::string &content) const;
+        virtual bool WriteAllAt(const Directory &directory, const PathType &name, std::string_view content,
+                                bool defer_close = false);
+
+        /**
+         * Completes operations, that were postponed by WriteAll.
+         */
+        virtual void FlushDeferred() {}
+
+        /**
+         * @return Identifier of the device, that holds the file. Used to limit concurrent I/O.
+         */
+        virtual DeviceIdType DeviceOf(const PathType &path) const = 0;
+    };
+
+    /**
+     * Filesystem of the operating system, implemented with std::filesystem and file streams.
+     * Whole files are read and written with plain system calls, a small file takes a single
+     * read or a single open, write and close. Trees are walked and copied with descriptors of
+     * directories, and opened directories let files be accessed with openat.
+     */
+    class NativeFileSystem : public BasicFileSystem {
+     public:
+        // Deferred descriptors are closed by batches of this size.
+        static constexpr size_t CLOSE_BATCH = 64;
+        // Directories beyond this number of simultaneously opened ones are accessed by paths.
+        static constexpr size_t MAX_OPEN_DIRECTORIES = 256;
+
+        NativeFileSystem() = default;
+        NativeFileSystem(const NativeFileSystem &) = delete;
+        NativeFileSystem &operator=(const NativeFileSystem &) = delete;
+        ~NativeFileSystem() override { FlushDeferred(); }
+
+        /**
+         * @return Shared instance, that is used by finders and generators by default.
+         */
+        static FileSystemShPtr Instance();
+
+        bool Exists(const PathType &path) const override;
+        bool IsDirectory(const PathType &path) const override;
+        void Walk(const PathType &root, bool recursive, const WalkVisitor &visitor) const override;
+        void CreateDirectories(const PathType &path) override;
+        void CopyDirectoryTree(const PathType &from, const PathType &to) override;
+        void CopyFile(const PathType &from, const PathType &to) override;
+        bool RemoveFile(const PathType &path) override;
+        IStreamPtr OpenRead(const PathType &path) const override;
+        OStreamPtr OpenWrite(const PathType &path) override;
+        bool ReadAll(const PathType &path, uintmax_t size_hint, std::string &content) const override;
+
+        /**
+         * Deferred descriptors are closed by batches, so the writing thread does not wait for
+         * closing of every file. Errors of deferred closes are not reported.
+         */
+        bool WriteAll(const PathType &path, std::string_view content, bool defer_close = false) override;
+        DirectoryShPtr OpenDirectory(const PathType &path) const override;
+        bool ReadAllAt(const Directory &directory, const PathType &name, uintmax_t size_hint,
+                       std::string &content) const override;
+        bool WriteAllAt(const Directory &directory, const PathType &name, std::string_view content,
+                        bool defer_close = false) override;
+        void FlushDeferred() override;
+        DeviceIdType DeviceOf(const PathType &path) const override;
+
+     private:
+        std::mutex m_deferred_mutex;
+        std::vector<int> m_deferred_closes;
+        mutable std::atomic<size_t> m_open_directories = 0;
+
+        /**
+         * Closes the written descriptor or postpones closing.
+         * @return false if the file was not written.
+         */
+        bool CloseWritten(int fd, bool defer_close);
+    };
+
+    /**
+     * Filesystem, that is kept entirely in memory. Contents of files are stored in the arena
+     * of large blocks and read without copying, so huge synthetic trees are built and generated
+     * without any system calls. Thread safe.
+     */
+    class MemoryFileSystem : public BasicFileSystem {
+     public:
+        MemoryFileSystem() = default;
+
+        /**
+         * Creates or replaces file, missing parent directories are created.
+         */
+        void AddFile(const PathType &path, std::string_view content);
+        void AddDirectory(const PathType &path) { CreateDirectories(path); }
+
+        /**
+         * @return Content of the file or std::nullopt, if there is no such file.
+         */
+        std::optional<std::string_view> ReadFile(const PathType &path) const;
+
+        bool Exists(const PathType &path) const override;
+        bool IsDirectory(const PathType &path) const override;
+        void Walk(const PathType &root, bool recursive, const WalkVisitor &visitor) const override;
+        void CreateDirectories(const PathType &path) override;
+        void CopyDirectoryTree(const PathType &from, const PathType &to) override;
+        void CopyFile(const PathType &from, const PathType &to) override;
+        bool RemoveFile(const PathType &path) override;
+        IStreamPtr OpenRead(const PathType &path) const override;
+        OStreamPtr OpenWrite(const PathType &path) override;
+        bool ReadAll(const PathType &path, uintmax_t size_hint, std::string &content) const override;
+        DeviceIdType DeviceOf(const PathType &) const override { return 0; }
+
+     private:
+        static constexpr size_t ARENA_BLOCK_SIZE = 1 << 20;
+
+        class WriteStream;
+
+        struct Node {
+            bool is_directory;
+            std::string_view content;
+        };
+
+        /**
+         * Orders paths as a depth-first walk does: separator is less than any other character,
+         * so subtree of a directory is one contiguous range right after the directory itself.
+         */
+        struct PathLess {
+            using is_transparent = void;
+            bool operator()(std::string_view lhs, std::string_view rhs) const;
+        };
+
+        mutable std::mutex m_mutex;
+        std::map<std::string, Node, PathLess> m_nodes;
+        std::vector<std::unique_ptr<char[]>> m_arena;
+        size_t m_arena_used = ARENA_BLOCK_SIZE;
+
+        static std::string Key(const PathType &path);
+        std::string_view Store(std::string_view content);
+        void CreateDirectoriesLocked(std::string_view key);
+        void AddFileLocked(const std::string &key, std::string_view content);
+    };
+}  // namespace ffinder
+
+#endif  // PROJECT_INCLUDE_FILESYSTEM_HPP_
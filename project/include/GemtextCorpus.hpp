@@ -0,0 +1,42 @@
+#ifndef PROJECT_INCLUDE_GEMTEXTCORPUS_HPP_
+#define PROJECT_INCLUDE_GEMTEXTCORPUS_HPP_
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace generator {
+    /**
+     * Generator of random, but structured gemtext documents for fuzzing. Unlike random bytes,
+     * generated lines have valid prefixes, so they reach every line translator, and are mixed
+     * with malformed ones (empty headers, unterminated preformatted blocks) and with characters,
+     * that have to be escaped. Documents are reproducible by seed.
+     */
+    class GemtextCorpusGenerator {
+     public:
+        explicit GemtextCorpusGenerator(uint64_t seed) : m_rng(seed) {}
+
+        /**
+         * @param lines Number of lines in the document.
+         */
+        std::string Document(size_t lines);
+
+        std::string Line();
+
+        /**
+         * Documents of the given approximate size, that stress single aspects of the translator:
+         * long lines, dense escaping, list toggling, long runs of leading spaces, etc.
+         * Time of their translation should grow linearly with the size.
+         */
+        static std::vector<std::string> PathologicalDocuments(size_t size);
+
+     private:
+        std::mt19937_64 m_rng;
+
+        size_t Uniform(size_t bound) { return std::uniform_int_distribution<size_t>(0, bound - 1)(m_rng); }
+        std::string Text(size_t max_size);
+    };
+}  // namespace generator
+
+#endif  // PROJECT_INCLUDE_GEMTEXTCORPUS_HPP_
@@ -1,12 +1,15 @@
 #ifndef PROJECT_INCLUDE_GENERATOR_HPP_
 #define PROJECT_INCLUDE_GENERATOR_HPP_
 
+#include <cstdint>
 #include <exception>
 #include <filesystem>
-#include <fstream>
 #include <string_view>
+#include <vector>
 
 #include "FSEntryFinder.hpp"
+#include "Scheduler.hpp"
+#include "Sharding.hpp"
 #include "Translator.hpp"
 
 namespace generator {
@@ -21,6 +24,11 @@ namespace generator {
             const char *what() const noexcept override { return "Passed directory does not exist."; }
         };
 
+        class UnknownTranslatorError : GeneratorError {
+         public:
+            const char *what() const noexcept override { return "Rules refer to unknown translator."; }
+        };
+
         class ErrorFileOpen : GeneratorError {
          public:
             const char *what() const noexcept override { return "ErrorFileOpen occur."; }
@@ -31,10 +39,20 @@ namespace generator {
         };
     }  // namespace exceptions
 
+    struct SmallFileConfig {
+        // Pages smaller than this size are read, translated and written in memory with single
+        // system calls instead of file streams, 0 disables the fast path.
+        uintmax_t max_size = 64 << 10;
+        // Whether written pages are closed in batches after they are written, see BasicFileSystem::WriteAll.
+        bool defer_close = false;
+    };
+
     class BasicWebsiteGenerator {
      public:
         using DirectoryIter = std::filesystem::recursive_directory_iterator;
         using FSFinderPtrType = ffinder::BasicFSFinder<DirectoryIter>::FSFinderShPtr;
+        using FileSystemShPtr = ffinder::BasicFileSystem::FileSystemShPtr;
+        using DirectoryShPtr = ffinder::BasicFileSystem::DirectoryShPtr;
 
         BasicWebsiteGenerator() = default;
 
@@ -50,12 +68,45 @@ namespace generator {
 
         void ResetFinder(const FSFinderPtrType &finder) { m_finder = finder; }
 
+        /**
+         * Restricts generation to the slice of input directory owned by the shard. Shards with
+         * the same count write disjoint sets of files, so they can share the output directory.
+         * Sharded generation writes the manifest of the shard, even if it is the only one.
+         */
+        void SetShard(const ShardSpec &shard) {
+            m_partitioner = ShardPartitioner(shard);
+            m_sharded = true;
+        }
+
+        /**
+         * Sets filesystem, that holds input and output directories. Finder should be created
+         * with the same filesystem.
+         */
+        void SetFileSystem(const FileSystemShPtr &file_system) { m_file_system = file_system; }
+
+        /**
+         * Sets number of workers used by Generate. Files are processed largest first,
+         * translations and copies are run by separate workers.
+         */
+        void SetScheduling(const SchedulerConfig &config) { m_scheduling = config; }
+
+        /**
+         * Sets handling of small pages, which are the most of pages of usual sites.
+         */
+        void SetSmallFiles(const SmallFileConfig &config) { m_small_files = config; }
+
+        /**
+         * Sets rules, that allow to skip files and choose translators by path patterns.
+         * Include and exclude rules are applied by the finder, see FilteredBasicFSFinder.
+         */
+        virtual void SetRules(const ffinder::RuleSet::RuleSetShPtr &rules) { m_rules = rules; }
+
         virtual ~BasicWebsiteGenerator() = default;
 
      protected:
         /**
          * Allows you to select a translator depending on the file.
-         * @param file Path to file.
+         * @param file Path to file relative to input directory.
          * @return Translator
          */
         virtual BasicTranslator::TranslatorShPtr GetTranslator(const ffinder::PathType &file) = 0;
@@ -66,10 +117,28 @@ namespace generator {
          */
         ffinder::FSEntityList LoadInputDirectory(const ffinder::PathType &input_dir) const;
 
-        static bool IsExists(const ffinder::PathType &path) { return std::filesystem::exists(path); }
+        bool IsExists(const ffinder::PathType &path) const { return m_file_system->Exists(path); }
+
+        ffinder::BasicFileSystem &FileSystem() const { return *m_file_system; }
+
+        const ShardPartitioner &Partitioner() const { return m_partitioner; }
+
+        bool Sharded() const { return m_sharded; }
+
+        const ffinder::RuleSet::RuleSetShPtr &Rules() const { return m_rules; }
+
+        const SchedulerConfig &Scheduling() const { return m_scheduling; }
+
+        const SmallFileConfig &SmallFiles() const { return m_small_files; }
 
      private:
         FSFinderPtrType m_finder;
+        ShardPartitioner m_partitioner;
+        bool m_sharded = false;
+        ffinder::RuleSet::RuleSetShPtr m_rules;
+        SchedulerConfig m_scheduling;
+        SmallFileConfig m_small_files;
+        FileSystemShPtr m_file_system = ffinder::NativeFileSystem::Instance();
     };
 
     class GemtextGenerator : public BasicWebsiteGenerator {
@@ -77,17 +146,52 @@ namespace generator {
         static constexpr std::string_view GEM_EXT = ".gmi";
         static constexpr std::string_view HTML_EXT = ".html";
 
+        // Translator names, that can be used in translate rules.
+        static constexpr std::string_view GEMTEXT_TRANSLATOR = "gemtext";
+        static constexpr std::string_view COPY_TRANSLATOR = "copy";
+
         GemtextGenerator() = default;
 
         explicit GemtextGenerator(const FSFinderPtrType &finder) : BasicWebsiteGenerator(finder) {}
 
         void Generate(const ffinder::PathType &input_dir, const ffinder::PathType &output_dir) override;
 
+        void SetRules(const ffinder::RuleSet::RuleSetShPtr &rules) override;
+
      protected:
         BasicTranslator::TranslatorShPtr GetTranslator(const ffinder::PathType &file) override;
 
      private:
-        static void CheckStreams(const std::ifstream &ifs, const std::ofstream &ofs);
+        static void CheckStreams(const ffinder::BasicFileSystem::IStreamPtr &is,
+                                 const ffinder::BasicFileSystem::OStreamPtr &os);
+        /**
+         * Translates the page with file streams. Partial output is removed, if reading or translation fails.
+         */
+        void TranslateFile(BasicTranslator &translator, const ffinder::PathType &input_file,
+                           const ffinder::PathType &output_file) const;
+
+        /**
+         * Fast path of TranslateFile for small pages: input is read into the thread local buffer,
+         * translated in memory and written at once. Files are accessed by names relative to
+         * their directories. Like TranslateFile, it leaves no output on errors.
+         * @param size Size of the input file found by the finder.
+         */
+        void TranslateSmallFile(BasicTranslator &translator, const ffinder::BasicFileSystem::Directory &input_dir,
+                                const ffinder::PathType &input_name,
+                                const ffinder::BasicFileSystem::Directory &output_dir,
+                                const ffinder::PathType &output_name, uintmax_t size) const;
+
+        /**
+         * Chooses the translator name for the file. Translate rules take precedence over
+         * the default extension based choice.
+         * @param rel_path Path to file relative to input directory.
+         */
+        std::string_view Route(const ffinder::PathType &rel_path) const;
+        void WriteManifest(const ffinder::PathType &output_dir, const std::vector<ffinder::PathType> &generated) const;
+
+        // Translators are stateless, so one instance of each is created lazily and shared by all files.
+        BasicTranslator::TranslatorShPtr m_gemtext_translator;
+        BasicTranslator::TranslatorShPtr m_copy_translator;
     };
 }  // namespace generator
 
@@ -0,0 +1,35 @@
+#ifndef PROJECT_INCLUDE_HTMLESCAPE_HPP_
+#define PROJECT_INCLUDE_HTMLESCAPE_HPP_
+
+#include <string>
+#include <string_view>
+
+namespace generator {
+    /**
+     * Text context escapes characters, that can start markup ('<', '>' and '&'). Attribute
+     * context additionally escapes quotes, so value can be placed into quoted attribute.
+     */
+    enum class EscapeContext { Text, Attribute };
+
+    /**
+     * Searches for the first character, that should be escaped in the context. On x86 the
+     * input is scanned by 16 bytes with SSE2, because such characters are rare in real text.
+     * @param data Text to scan.
+     * @param pos Position to start from.
+     * @return Position of the character or std::string_view::npos.
+     */
+    size_t FindEscapable(std::string_view data, size_t pos, EscapeContext context);
+
+    /**
+     * Appends escaped data to the output. Runs of clean characters are appended unchanged,
+     * so text without special characters is copied with a single append.
+     */
+    void AppendEscaped(std::string &out, std::string_view data, EscapeContext context = EscapeContext::Text);
+
+    /**
+     * Character by character reference implementation of AppendEscaped.
+     */
+    void AppendEscapedScalar(std::string &out, std::string_view data, EscapeContext context = EscapeContext::Text);
+}  // namespace generator
+
+#endif  // PROJECT_INCLUDE_HTMLESCAPE_HPP_
@@ -0,0 +1,66 @@
+#ifndef PROJECT_INCLUDE_PAGECACHE_HPP_
+#define PROJECT_INCLUDE_PAGECACHE_HPP_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace generator {
+    /**
+     * Bounded LRU cache of translated pages. Cache is split into shards with separate locks,
+     * so parallel requests to different pages do not contend. Every page remembers modification
+     * time of its source, page with different time is treated as missing.
+     */
+    class PageCache {
+     public:
+        using ContentPtr = std::shared_ptr<const std::string>;
+        using TimeType = int64_t;
+
+        static constexpr size_t DEFAULT_SHARDS = 16;
+
+        /**
+         * @param capacity Total size of cached pages in bytes.
+         * @param shards Number of independent shards.
+         */
+        explicit PageCache(size_t capacity, size_t shards = DEFAULT_SHARDS);
+
+        /**
+         * @param mtime Current modification time of the page source.
+         * @return Page or nullptr, if page is not cached or its source was modified.
+         */
+        ContentPtr Get(const std::string &key, TimeType mtime);
+
+        void Put(const std::string &key, TimeType mtime, ContentPtr content);
+
+        /**
+         * @return Total size of cached pages in bytes.
+         */
+        size_t Size() const;
+
+     private:
+        struct Entry {
+            std::string key;
+            TimeType mtime;
+            ContentPtr content;
+        };
+
+        struct Shard {
+            mutable std::mutex mutex;
+            std::list<Entry> lru;  // most recently used pages are in front
+            std::unordered_map<std::string, std::list<Entry>::iterator> index;
+            size_t size = 0;
+        };
+
+        std::vector<std::unique_ptr<Shard>> m_shards;
+        size_t m_shard_capacity;
+
+        Shard &ShardOf(const std::string &key);
+        static void Erase(Shard &shard, std::list<Entry>::iterator entry);
+    };
+}  // namespace generator
+
+#endif  // PROJECT_INCLUDE_PAGECACHE_HPP_
@@ -0,0 +1,158 @@
+#ifndef PROJECT_INCLUDE_PATHTABLE_HPP_
+#define PROJECT_INCLUDE_PATHTABLE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ffinder {
+    /**
+     * Compact table of file paths. Every path component is interned once as a node, which holds
+     * index of the parent node and offset of the name in the single string arena, so files of
+     * one directory share the directory prefix. Paths are stored relative to the root, that
+     * allows to get relative paths for input and output without any filesystem calls.
+     *
+     * Iteration order is the same as the order of std::set<std::filesystem::path>, i. e.
+     * component-wise lexicographical. Table is sorted lazily, only when it is iterated.
+     */
+    class PathTable {
+     public:
+        using IndexType = uint32_t;
+        using PathType = std::filesystem::path;
+
+        static constexpr IndexType NO_INDEX = std::numeric_limits<IndexType>::max();
+        static constexpr char SEPARATOR = '/';
+
+        /**
+         * Lightweight handle of the file in the table. Paths are materialized on demand.
+         */
+        class Entry {
+         public:
+            Entry(const PathTable &table, IndexType node) : m_table(&table), m_node(node) {}
+
+            /**
+             * @return Path, that combines table root and relative path, e. g. path to the input file.
+             */
+            PathType Path() const { return m_table->Root() / Relative(); }
+
+            PathType Relative() const { return m_table->RelativeString(m_node); }
+
+            std::string RelativeString() const { return m_table->RelativeString(m_node); }
+
+            std::string_view Name() const { return m_table->Name(m_node); }
+
+            /**
+             * @return Size of the file in bytes, as it was found during the scan.
+             */
+            uintmax_t Size() const { return m_table->m_nodes[m_node].size; }
+
+            /**
+             * @return Index of directory node, that contains file.
+             */
+            IndexType Parent() const { return m_table->m_nodes[m_node].parent; }
+
+            IndexType Index() const { return m_node; }
+
+         private:
+            const PathTable *m_table;
+            IndexType m_node;
+        };
+
+        class ConstIterator {
+         public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Entry;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = Entry;
+
+            ConstIterator(const PathTable &table, std::vector<IndexType>::const_iterator it)
+                : m_table(&table), m_it(it) {}
+
+            Entry operator*() const { return {*m_table, *m_it}; }
+            ConstIterator &operator++() {
+                ++m_it;
+                return *this;
+            }
+            bool operator==(const ConstIterator &other) const { return m_it == other.m_it; }
+            bool operator!=(const ConstIterator &other) const { return m_it != other.m_it; }
+
+         private:
+            const PathTable *m_table;
+            std::vector<IndexType>::const_iterator m_it;
+        };
+
+        using const_iterator = ConstIterator;
+
+        PathTable() = default;
+
+        /**
+         * @param root Directory, relative to which paths are stored.
+         */
+        explicit PathTable(const PathType &root) : m_root(root) {}
+
+        PathTable(std::initializer_list<PathType> paths);
+
+        /**
+         * Adds file to the table. Path should start with the table root, otherwise it is
+         * stored relative to the root lexically.
+         * @return true if path was added, false if it is already in the table, or it is a directory
+         * of another file, or one of its directories is a file.
+         */
+        bool emplace(const PathType &path);
+
+        /**
+         * Adds file by its path relative to the table root.
+         * @param relative Relative path with '/' separators.
+         * @param size Size of the file, if it is known.
+         * @return The same as emplace.
+         */
+        bool EmplaceRelative(std::string_view relative, uintmax_t size = 0);
+
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+        size_t size() const { return m_files.size(); }
+        bool empty() const { return m_files.empty(); }
+
+        const PathType &Root() const { return m_root; }
+
+        std::string RelativeString(IndexType node) const;
+        std::string_view Name(IndexType node) const;
+
+        /**
+         * Tables are equal, if they contain the same paths (roots are taken into account).
+         */
+        bool operator==(const PathTable &other) const;
+        bool operator!=(const PathTable &other) const { return !(*this == other); }
+
+     private:
+        struct Node {
+            IndexType parent;
+            IndexType name_offset;
+            IndexType name_size;
+            bool is_file;
+            bool is_directory;  // node is a parent of other nodes
+            uintmax_t size;
+        };
+
+        PathType m_root;
+        std::string m_arena;
+        std::vector<Node> m_nodes;
+        std::vector<IndexType> m_slots;  // open addressing table of interned nodes
+        mutable std::vector<IndexType> m_files;  // file nodes, sorted lazily
+        mutable bool m_sorted = true;
+
+        IndexType Intern(IndexType parent, std::string_view name);
+        static size_t Hash(IndexType parent, std::string_view name);
+        void Rehash(size_t slots_count);
+        void Sort() const;
+    };
+}  // namespace ffinder
+
+#endif  // PROJECT_INCLUDE_PATHTABLE_HPP_
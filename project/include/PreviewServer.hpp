@@ -0,0 +1,140 @@
+#ifndef PROJECT_INCLUDE_PREVIEWSERVER_HPP_
+#define PROJECT_INCLUDE_PREVIEWSERVER_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "PageCache.hpp"
+
+namespace generator {
+    namespace exceptions {
+        class ServerError : public std::exception {
+         public:
+            const char *what() const noexcept override { return "ServerError occur"; }
+        };
+
+        class ServerStartError : public ServerError {
+         public:
+            const char *what() const noexcept override { return "Preview server can not listen on the port"; }
+        };
+    }  // namespace exceptions
+
+    struct PreviewServerConfig {
+        std::string address = "127.0.0.1";
+        // 0 means any free port, it is returned by PreviewServer::Start.
+        uint16_t port = 0;
+        size_t workers = 4;
+        size_t cache_capacity = 64 << 20;
+    };
+
+    /**
+     * HTTP server for previewing the site without generation. Request of "page.html" is served
+     * by translating "page.gmi" of the input directory on demand, translated pages are kept in
+     * the cache until their sources are modified. Other files are sent as is with sendfile.
+     *
+     * Connections are accepted by a single epoll loop, ready connections are handed over
+     * to the pool of workers, so slow translation does not block other clients.
+     */
+    class PreviewServer {
+     public:
+        using PathType = std::filesystem::path;
+
+        static constexpr std::string_view GEMTEXT_EXTENSION = ".gmi";
+        static constexpr std::string_view HTML_EXTENSION = ".html";
+        static constexpr std::string_view INDEX_PAGE = "index.html";
+
+        PreviewServer(const PathType &root, const PreviewServerConfig &config = {});
+        ~PreviewServer();
+
+        PreviewServer(const PreviewServer &) = delete;
+        PreviewServer &operator=(const PreviewServer &) = delete;
+
+        /**
+         * Starts listening and serving in background threads.
+         * @return Port, that the server listens on.
+         */
+        uint16_t Start();
+
+        /**
+         * Starts the server and blocks until it is stopped.
+         */
+        void Run();
+
+        /**
+         * Blocks until the started server is stopped.
+         */
+        void Wait();
+
+        /**
+         * Stops serving and closes all connections. Can be called from any thread.
+         */
+        void Stop();
+
+        const PageCache &Cache() const { return m_cache; }
+
+     private:
+        static constexpr size_t MAX_EVENTS = 64;
+        static constexpr size_t MAX_REQUEST_SIZE = 16 << 10;
+        static constexpr int SOCKET_TIMEOUT_SECONDS = 5;
+
+        PathType m_root;
+        PreviewServerConfig m_config;
+        PageCache m_cache;
+
+        int m_listen_fd = -1;
+        int m_epoll_fd = -1;
+        int m_stop_fd = -1;
+        std::thread m_loop;
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mutex;
+        std::condition_variable m_ready;
+        std::condition_variable m_stopped;
+        std::deque<int> m_ready_connections;
+        std::unordered_set<int> m_connections;
+        bool m_stopping = false;
+
+        void Loop();
+        void Accept();
+        void Work();
+
+        /**
+         * Reads requests from the connection, that became readable, and responds to them.
+         * @return Whether connection should be kept open for the next request.
+         */
+        bool HandleConnection(int fd);
+
+        /**
+         * @param request Request line and headers.
+         * @return Whether connection should be kept open.
+         */
+        bool Respond(int fd, const std::string &request);
+        void Close(int fd);
+
+        /**
+         * Resolves symbolic links of the path in the served directory.
+         * @return Canonical path or std::nullopt, if the path does not exist or leads outside of the directory.
+         */
+        std::optional<PathType> Resolve(const PathType &path) const;
+
+        /**
+         * @param path Decoded path of the request target.
+         * @param encoded_path Path of the request target as it was received.
+         */
+        bool ServeFile(int fd, const std::string &path, std::string_view encoded_path, bool head, bool keep_alive);
+        bool ServePage(int fd, const PathType &source, PageCache::TimeType mtime, bool head, bool keep_alive);
+        PageCache::ContentPtr Translate(const PathType &source) const;
+    };
+}  // namespace generator
+
+#endif  // PROJECT_INCLUDE_PREVIEWSERVER_HPP_
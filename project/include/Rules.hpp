@@ -0,0 +1,161 @@
+#ifndef PROJECT_INCLUDE_RULES_HPP_
+#define PROJECT_INCLUDE_RULES_HPP_
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ffinder {
+    namespace exceptions {
+        class RulesError : public std::exception {
+         public:
+            const char *what() const noexcept override { return "RulesError occur"; }
+        };
+
+        class RulesFileError : public RulesError {
+         public:
+            const char *what() const noexcept override { return "Rules file can not be opened"; }
+        };
+
+        class RuleSyntaxError : public RulesError {
+         public:
+            const char *what() const noexcept override { return "Rules file contains invalid rule"; }
+        };
+    }  // namespace exceptions
+
+    /**
+     * Glob pattern compiled once into a bit-parallel NFA. Each pattern token is an NFA state,
+     * so set of active states fits into a single machine word. Transitions are precomputed
+     * per character in shift-and style, so each path character costs a few word operations.
+     *
+     * Supported syntax: '*' matches any characters except '/', '**' matches any characters,
+     * '**' followed by '/' matches zero or more directories, '?' matches one character except '/',
+     * '[abc]', '[a-z]' and '[!abc]' match one character from (not from) the class.
+     * Pattern without '/' is matched against the file name only, so "*.gmi" matches files at any depth.
+     */
+    class GlobPattern {
+     public:
+        static constexpr size_t MAX_TOKENS = 63;
+
+        explicit GlobPattern(std::string_view pattern);
+
+        /**
+         * @param path Path relative to the input directory with '/' separators.
+         */
+        bool Match(std::string_view path) const;
+
+        /**
+         * Checks whether directory itself or everything beneath it matches the pattern,
+         * i. e. "drafts" matches both the directory and everything below drafts/.
+         */
+        bool MatchDirectory(std::string_view path) const;
+
+        /**
+         * Checks whether some path beneath the directory may match the pattern.
+         */
+        bool MayMatchBeneath(std::string_view path) const;
+
+        const std::string &Source() const { return m_source; }
+
+     private:
+        static constexpr size_t ALPHABET_SIZE = 256;
+        static constexpr size_t DIR_STAR_GROUP_SIZE = 3;
+
+        // DirStar is an epsilon state of "**/" group, that is followed by DoubleStar and DirSeparator
+        // states and allows to bypass them, so group matches zero or more directories.
+        enum class TokenType : uint8_t { Literal, AnyChar, Class, Star, DoubleStar, DirStar, DirSeparator };
+
+        struct Token {
+            TokenType type;
+            char literal = 0;
+            bool negated = false;
+            std::string ranges{};  // pairs of [first, last] characters for Class
+        };
+
+        std::string m_source;
+        // States, that consume the character and move to the next state.
+        std::array<uint64_t, ALPHABET_SIZE> m_advance{};
+        // States, that consume the character and stay.
+        std::array<uint64_t, ALPHABET_SIZE> m_loop{};
+        uint64_t m_epsilon_next = 0;
+        uint64_t m_epsilon_skip = 0;
+        uint64_t m_accept = 0;
+        std::string m_literal_prefix;
+        std::string m_literal_suffix;
+        bool m_basename_only = false;
+
+        void Compile(const std::vector<Token> &tokens);
+        uint64_t Closure(uint64_t states) const;
+        uint64_t Step(uint64_t states, char c) const;
+        uint64_t Feed(std::string_view path, bool trailing_separator) const;
+        bool Run(std::string_view path, bool trailing_separator) const;
+        static bool ClassMatch(const Token &token, char c);
+    };
+
+    enum class RuleAction { Include, Exclude, Skip, Translate };
+
+    struct Rule {
+        RuleAction action;
+        GlobPattern pattern;
+        std::string translator;
+    };
+
+    /**
+     * Ordered set of filter and routing rules. Config file consists of lines:
+     *
+     *   include <glob>               - only matching files are generated (if any include rule exists)
+     *   exclude <glob>               - matching files and everything in matching directories are ignored,
+     *                                  directories are not scanned unless a later include rule may match
+     *                                  beneath them
+     *   skip <glob>                  - matching files are found, but nothing is generated for them
+     *   translate <glob> <translator> - generate matching files with the named translator
+     *
+     * Empty lines and lines starting with '#' are ignored. For include and exclude rules
+     * the last matching rule wins, for translate rules the first one.
+     */
+    class RuleSet {
+     public:
+        using RuleSetShPtr = std::shared_ptr<const RuleSet>;
+
+        RuleSet() = default;
+
+        static RuleSet Load(const std::filesystem::path &config);
+        static RuleSet Parse(std::istream &is);
+
+        void Add(RuleAction action, std::string_view pattern, std::string_view translator = {});
+
+        /**
+         * Exclude rule, that matches an ancestor directory, matches the path too, so the result does not
+         * depend on whether the walk pruned the ancestor. Excluded directory means, that the whole subtree
+         * can be pruned, so directory is not excluded, while an include rule following the deciding exclude
+         * rule may match beneath it.
+         * @param rel_path Path relative to input directory.
+         * @param is_directory Whether path is a directory.
+         */
+        bool IsExcluded(std::string_view rel_path, bool is_directory) const;
+
+        bool IsSkipped(std::string_view rel_path) const;
+
+        /**
+         * @return Name of the translator of the first matching translate rule, if any.
+         */
+        std::optional<std::string_view> TranslatorFor(std::string_view rel_path) const;
+
+        const std::vector<Rule> &Rules() const { return m_rules; }
+
+        bool Empty() const { return m_rules.empty(); }
+
+     private:
+        std::vector<Rule> m_rules;
+        bool m_has_include = false;
+    };
+}  // namespace ffinder
+
+#endif  // PROJECT_INCLUDE_RULES_HPP_
@@ -0,0 +1,76 @@
+#ifndef PROJECT_INCLUDE_SCHEDULER_HPP_
+#define PROJECT_INCLUDE_SCHEDULER_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace generator {
+    struct SchedulerConfig {
+        // Number of workers for translation jobs, 0 means number of hardware threads.
+        size_t cpu_workers = 0;
+        // Number of dedicated workers for copy jobs.
+        size_t io_workers = 2;
+        // Maximum number of copy jobs, that are run concurrently on one device, at least 1.
+        size_t io_per_device = 2;
+        // Runs with less data in total are done by the calling thread, because starting
+        // workers costs more than they save on small sites.
+        uintmax_t serial_bytes = 256 << 10;
+    };
+
+    /**
+     * Runs generation jobs in order, that minimizes makespan. Jobs are started largest first
+     * (LPT rule), so the run does not end with a single long job. CPU bound jobs (translation)
+     * and I/O bound jobs (copying) are run by separate workers, so small pages are translated
+     * while big assets are copied. When CPU jobs are drained, CPU workers help with I/O jobs.
+     * Small runs are done without workers at all, see SchedulerConfig::serial_bytes.
+     */
+    class SizeAwareScheduler {
+     public:
+        using TaskType = std::function<void()>;
+        using DeviceIdType = uint64_t;
+
+        /**
+         * Zero io_per_device would never let copy jobs start, so it is treated as 1.
+         */
+        explicit SizeAwareScheduler(const SchedulerConfig &config = {});
+
+        void AddCpuJob(uintmax_t size, TaskType task);
+        void AddIoJob(uintmax_t size, DeviceIdType device, TaskType task);
+
+        /**
+         * Runs all added jobs and waits for them. If some job throws, jobs that are not started
+         * yet are dropped and the first exception is rethrown.
+         */
+        void Run();
+
+     private:
+        struct Job {
+            uintmax_t size;
+            DeviceIdType device;
+            TaskType task;
+        };
+
+        SchedulerConfig m_config;
+        std::vector<Job> m_cpu_jobs;
+        std::list<Job> m_io_jobs;  // jobs are taken not only from the front, when device is busy
+
+        std::mutex m_mutex;
+        std::condition_variable m_io_released;
+        size_t m_next_cpu_job = 0;
+        std::map<DeviceIdType, size_t> m_io_in_flight;
+        std::exception_ptr m_error;
+
+        void CpuWorker();
+        void IoWorker();
+        bool RunNextIoJob();
+        void Execute(Job &job);
+    };
+}  // namespace generator
+
+#endif  // PROJECT_INCLUDE_SCHEDULER_HPP_
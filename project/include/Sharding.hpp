@@ -0,0 +1,97 @@
+#ifndef PROJECT_INCLUDE_SHARDING_HPP_
+#define PROJECT_INCLUDE_SHARDING_HPP_
+
+#include <cstdint>
+#include <exception>
+#include <string_view>
+
+#include "FSEntryFinder.hpp"
+
+namespace generator {
+    namespace exceptions {
+        class ShardError : public std::exception {
+         public:
+            const char *what() const noexcept override { return "ShardError occur."; }
+        };
+
+        class InvalidShardSpecError : public ShardError {
+         public:
+            const char *what() const noexcept override { return "Shard must be specified as i/N, where i < N."; }
+        };
+
+        class ShardManifestError : public ShardError {
+         public:
+            const char *what() const noexcept override { return "Shard manifest is missing or can not be accessed."; }
+        };
+    }  // namespace exceptions
+
+    /**
+     * Describes which slice of the input tree current process is responsible for.
+     * Shard with count 1 means, that the whole tree is processed by single process.
+     */
+    struct ShardSpec {
+        size_t index = 0;
+        size_t count = 1;
+
+        /**
+         * Parses shard specification in form "i/N".
+         * @param spec String representation of shard.
+         * @return Parsed shard.
+         */
+        static ShardSpec Parse(std::string_view spec);
+
+        bool IsSingle() const { return count == 1; }
+    };
+
+    /**
+     * Deterministically partitions finder entries between shards. Partition depends only on
+     * path relative to the input directory, so independent processes (possibly on different
+     * hosts) get disjoint slices without any coordination. All files of one directory are
+     * placed into the same shard.
+     */
+    class ShardPartitioner {
+     public:
+        ShardPartitioner() = default;
+
+        explicit ShardPartitioner(const ShardSpec &spec) : m_spec(spec) {}
+
+        /**
+         * Computes shard, that owns the file.
+         * @param rel_path Path to file relative to input directory.
+         * @return Index of shard.
+         */
+        size_t ShardOf(const ffinder::PathType &rel_path) const;
+
+        bool Owns(const ffinder::PathType &rel_path) const { return ShardOf(rel_path) == m_spec.index; }
+
+        const ShardSpec &Spec() const { return m_spec; }
+
+        /**
+         * FNV-1a hash. Unlike std::hash, it is stable between runs, compilers and hosts.
+         */
+        static uint64_t Hash(std::string_view data);
+
+     private:
+        ShardSpec m_spec;
+    };
+
+    constexpr std::string_view MANIFEST_NAME = ".manifest";
+
+    /**
+     * Path of manifest, which lists all files generated by the shard.
+     */
+    ffinder::PathType ShardManifestPath(const ffinder::PathType &output_dir, const ShardSpec &spec);
+
+    /**
+     * Combines manifests of all shards into single site manifest and removes per-shard ones.
+     * Should be called once after all shard processes finished.
+     * @param output_dir Output directory shared by shards.
+     * @param shards_count Total number of shards.
+     * @param file_system Filesystem, that holds the output directory.
+     */
+    void MergeShardManifests(
+        const ffinder::PathType &output_dir, size_t shards_count,
+        const ffinder::BasicFileSystem::FileSystemShPtr &file_system = ffinder::NativeFileSystem::Instance());
+}  // namespace generator
+
+#endif  // PROJECT_INCLUDE_SHARDING_HPP_
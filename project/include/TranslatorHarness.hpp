@@ -0,0 +1,38 @@
+#ifndef PROJECT_INCLUDE_TRANSLATORHARNESS_HPP_
+#define PROJECT_INCLUDE_TRANSLATORHARNESS_HPP_
+
+#include <string>
+#include <string_view>
+
+namespace generator {
+    /**
+     * Straightforward implementation of gemtext to html translation, that works on the whole
+     * document in memory. It is not optimized on purpose and serves as the oracle for
+     * GemToHTMLTranslator: both should produce the same html or throw the same exception.
+     */
+    std::string ReferenceGemToHTML(std::string_view input);
+
+    struct DifferentialReport {
+        bool consistent = true;
+        // Description of the first mismatch, empty if translations are consistent.
+        std::string mismatch;
+    };
+
+    /**
+     * Translates input by every available path and compares results with the reference:
+     * GemToHTMLTranslator over a string stream, the same translator over a stream, that delivers
+     * input in small chunks of varying size (as a slow file or a socket does), the page generated
+     * by the small file fast path and by file streams, and vectorized HTML escaping of every line
+     * against the scalar one. Generated page must be absent, if translation fails.
+     */
+    DifferentialReport CheckTranslation(std::string_view input);
+
+    /**
+     * Measures how translation time scales with the input size. Input is repeated factor times
+     * and translated, the ratio of its time to factor times the time of the original input is
+     * returned, so linear translation gives about 1 and quadratic one gives about factor.
+     */
+    double TranslationScaling(std::string_view input, size_t factor);
+}  // namespace generator
+
+#endif  // PROJECT_INCLUDE_TRANSLATORHARNESS_HPP_
@@ -1,13 +1,30 @@
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "FSEntryFinder.hpp"
 #include "Generator.hpp"
+#include "PreviewServer.hpp"
+#include "Sharding.hpp"
 
-constexpr size_t EXPECTED_ARGS = 3;
-constexpr size_t INPUT_DIR_ARG = 1;
-constexpr size_t OUTPUT_DIR_ARG = 2;
+constexpr size_t EXPECTED_POSITIONAL_ARGS = 2;
+constexpr size_t INPUT_DIR_ARG = 0;
+constexpr size_t OUTPUT_DIR_ARG = 1;
+
+constexpr std::string_view SHARD_OPTION = "--shard";
+constexpr std::string_view MERGE_OPTION = "--merge";
+constexpr std::string_view RULES_OPTION = "--rules";
+constexpr std::string_view JOBS_OPTION = "--jobs";
+constexpr std::string_view IO_JOBS_OPTION = "--io-jobs";
+constexpr std::string_view SERVE_OPTION = "--serve";
+constexpr std::string_view SMALL_FILES_OPTION = "--small-files";
+constexpr std::string_view DEFER_CLOSE_OPTION = "--defer-close";
 
 void ShowUsage(std::ostream &os) {
     os << "Usage:\n";
@@ -15,20 +32,156 @@ void ShowUsage(std::ostream &os) {
           "It should contain the files from which the site structure will be generated (The"
           ".gmi files will be converted to html). The second argument is the output directory"
           "where the site structure with its sources will be placed.\n";
+    os << "Options:\n";
+    os << "  --shard i/N  Generate only i-th of N disjoint slices of the input directory. Shards\n"
+          "               may run as separate processes sharing the output directory.\n";
+    os << "  --rules FILE Filter and route files by rules from FILE (include, exclude, skip and\n"
+          "               translate rules with glob patterns).\n";
+    os << "  --jobs N     Number of workers translating pages (default: number of CPUs).\n";
+    os << "  --io-jobs N  Number of workers copying other files (default: 2).\n";
+    os << "  --small-files N\n"
+          "               Pages smaller than N bytes are translated in memory and written with\n"
+          "               a single write (default: 65536, 0 disables).\n";
+    os << "  --defer-close\n"
+          "               Close written pages in batches.\n";
+    os << "  --merge N    Instead of generation, combine manifests of N finished shards in the\n"
+          "               output directory (passed as the only argument).\n";
+    os << "  --serve PORT Instead of generation, serve the input directory (passed as the only\n"
+          "               argument) on localhost, pages are translated on request.\n";
+}
+
+struct Arguments {
+    std::vector<std::string> positional;
+    std::optional<generator::ShardSpec> shard;
+    size_t merge_shards = 0;
+    std::string rules_file;
+    generator::SchedulerConfig scheduling;
+    generator::SmallFileConfig small_files;
+    std::optional<uint16_t> serve_port;
+};
+
+bool ParseArguments(int argc, char *argv[], Arguments &args) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == SHARD_OPTION && has_value) {
+            args.shard = generator::ShardSpec::Parse(argv[++i]);
+        } else if (arg == MERGE_OPTION && has_value) {
+            args.merge_shards = std::stoul(argv[++i]);
+            if (args.merge_shards == 0) {
+                throw std::invalid_argument("Number of shards should be positive");
+            }
+        } else if (arg == JOBS_OPTION && has_value) {
+            args.scheduling.cpu_workers = std::stoul(argv[++i]);
+        } else if (arg == IO_JOBS_OPTION && has_value) {
+            args.scheduling.io_workers = std::stoul(argv[++i]);
+        } else if (arg == SMALL_FILES_OPTION && has_value) {
+            args.small_files.max_size = std::stoull(argv[++i]);
+        } else if (arg == DEFER_CLOSE_OPTION) {
+            args.small_files.defer_close = true;
+        } else if (arg == SERVE_OPTION && has_value) {
+            const unsigned long port = std::stoul(argv[++i]);
+            if (port > std::numeric_limits<uint16_t>::max()) {
+                throw std::out_of_range("Port is out of range");
+            }
+            args.serve_port = static_cast<uint16_t>(port);
+        } else if (arg == RULES_OPTION && has_value) {
+            args.rules_file = argv[++i];
+        } else if (arg.rfind("--", 0) == 0) {
+            return false;
+        } else {
+            args.positional.emplace_back(arg);
+        }
+    }
+    return true;
 }
 
 int main(int argc, char *argv[]) {
-    if (argc != EXPECTED_ARGS) {
+    Arguments args;
+    try {
+        if (!ParseArguments(argc, argv, args)) {
+            std::cerr << "Error. Unknown option\n";
+            ShowUsage(std::cerr);
+            return EXIT_FAILURE;
+        }
+    } catch (const generator::exceptions::InvalidShardSpecError &ex) {
+        std::cerr << ex.what() << '\n';
+        return EXIT_FAILURE;
+    } catch (const std::logic_error &ex) {
+        std::cerr << "Error. Invalid number\n";
+        return EXIT_FAILURE;
+    }
+
+    if (args.merge_shards != 0) {
+        if (args.positional.size() != 1) {
+            std::cerr << "Error. Merge expects only output directory\n";
+            ShowUsage(std::cerr);
+            return EXIT_FAILURE;
+        }
+        try {
+            generator::MergeShardManifests(args.positional.front(), args.merge_shards);
+        } catch (const generator::exceptions::ShardError &ex) {
+            std::cerr << "Merge failed. " << ex.what() << '\n';
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    if (args.serve_port) {
+        if (args.positional.size() != 1) {
+            std::cerr << "Error. Serve expects only input directory\n";
+            ShowUsage(std::cerr);
+            return EXIT_FAILURE;
+        }
+        if (!ffinder::IsDirectory(args.positional.front())) {
+            std::cerr << "Passed wrong directory paths.\n";
+            return EXIT_FAILURE;
+        }
+        generator::PreviewServerConfig config;
+        config.port = *args.serve_port;
+        generator::PreviewServer server(args.positional.front(), config);
+        try {
+            const uint16_t port = server.Start();
+            std::cerr << "Serving " << args.positional.front() << " at http://" << config.address << ':' << port
+                      << "/\n";
+            server.Wait();
+        } catch (const generator::exceptions::ServerError &ex) {
+            std::cerr << ex.what() << '\n';
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    if (args.positional.size() != EXPECTED_POSITIONAL_ARGS) {
         std::cerr << "Error. To few arguments\n";
         ShowUsage(std::cerr);
         return EXIT_FAILURE;
     }
 
-    auto finder = ffinder::CreateFinder<ffinder::RRegularFileFinder>();
-    generator::GemtextGenerator generator(finder);
+    generator::GemtextGenerator generator;
+    if (args.shard) {
+        generator.SetShard(*args.shard);
+    }
+    generator.SetScheduling(args.scheduling);
+    generator.SetSmallFiles(args.small_files);
+    if (args.rules_file.empty()) {
+        generator.ResetFinder(ffinder::CreateFinder<ffinder::RRegularFileFinder>());
+    } else {
+        try {
+            auto rules = std::make_shared<const ffinder::RuleSet>(ffinder::RuleSet::Load(args.rules_file));
+            generator.ResetFinder(ffinder::CreateFinder<ffinder::RFilteredFileFinder>(rules));
+            generator.SetRules(rules);
+        } catch (const ffinder::exceptions::RulesError &ex) {
+            std::cerr << ex.what() << '\n';
+            return EXIT_FAILURE;
+        } catch (const generator::exceptions::UnknownTranslatorError &ex) {
+            std::cerr << ex.what() << '\n';
+            return EXIT_FAILURE;
+        }
+    }
 
     try {
-        generator.Generate(argv[INPUT_DIR_ARG], argv[OUTPUT_DIR_ARG]);
+        generator.Generate(args.positional[INPUT_DIR_ARG], args.positional[OUTPUT_DIR_ARG]);
     } catch (const generator::exceptions::DirNotExistError &ex) {
         std::cerr << "Passed wrong directory paths.\n";
     } catch (const generator::exceptions::ErrorFileOpen &ex) {
@@ -1,8 +1,18 @@
 #include <FSEntryFinder.hpp>
 
+#include <sys/stat.h>
+
 namespace ffinder {
     namespace fs = std::filesystem;
 
     bool IsRegular(const PathType &file) { return fs::is_regular_file(file) && !fs::is_symlink(file); }
     bool IsDirectory(const PathType &file) { return std::filesystem::is_directory(file); }
+
+    DeviceIdType DeviceOf(const PathType &file) {
+        struct stat file_stat {};
+        if (stat(file.c_str(), &file_stat) != 0) {
+            return 0;
+        }
+        return static_cast<DeviceIdType>(file_stat.st_dev);
+    }
 }  // namespace ffinder
@@ -0,0 +1,657 @@
+#include "FileSystem.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "FSEntryFinder.hpp"
+
+namespace ffinder {
+    namespace fs = std::filesystem;
+
+    namespace {
+        constexpr char SEPARATOR = '/';
+        // Paths can not contain zero character. Within PathLess order it follows the separator,
+        // so "dir\0" is greater than any path of "dir/..." subtree and less than other paths.
+        constexpr char AFTER_SUBTREE = '\0';
+
+        bool StartsWith(std::string_view string, std::string_view prefix) {
+            return string.substr(0, prefix.size()) == prefix;
+        }
+
+        constexpr mode_t FILE_MODE = 0666;
+        constexpr mode_t DIRECTORY_MODE = 0777;
+
+        [[noreturn]] void ThrowSystemError(const char *what, const PathType &path) {
+            throw fs::filesystem_error(what, path, std::error_code(errno, std::generic_category()));
+        }
+
+        /**
+         * Opens subdirectory of the opened directory. Symbolic links are not followed, as walks do not visit them.
+         */
+        int OpenDirectoryAt(int dir_fd, const char *name) {
+            return openat(dir_fd, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+        }
+
+        struct DirCloser {
+            void operator()(DIR *dir) const { closedir(dir); }
+        };
+
+        using DirPtr = std::unique_ptr<DIR, DirCloser>;
+
+        DirPtr ReadDirectory(int dir_fd, const PathType &path) {
+            DIR *dir = fdopendir(dir_fd);
+            if (dir == nullptr) {
+                close(dir_fd);
+                ThrowSystemError("Can not read directory", path);
+            }
+            return DirPtr(dir);
+        }
+
+        /**
+         * Type of the directory entry. readdir gives it for free on most filesystems, otherwise
+         * the entry is stat'ed relative to the directory.
+         * @param size Size of regular file, it is stat'ed for size anyway.
+         */
+        unsigned char EntryType(DIR *dir, const dirent &entry, uintmax_t &size) {
+            if (entry.d_type != DT_REG && entry.d_type != DT_UNKNOWN) {
+                return entry.d_type;
+            }
+            struct stat entry_stat {};
+            if (fstatat(dirfd(dir), entry.d_name, &entry_stat, AT_SYMLINK_NOFOLLOW) != 0) {
+                return DT_UNKNOWN;
+            }
+            size = static_cast<uintmax_t>(entry_stat.st_size);
+            return S_ISREG(entry_stat.st_mode) ? DT_REG : S_ISDIR(entry_stat.st_mode) ? DT_DIR : DT_UNKNOWN;
+        }
+
+        /**
+         * Unlike EntryType, regular files are not stat'ed, when only directories are needed.
+         */
+        bool IsDirectoryEntry(DIR *dir, const dirent &entry) {
+            if (entry.d_type != DT_UNKNOWN) {
+                return entry.d_type == DT_DIR;
+            }
+            uintmax_t size = 0;
+            return EntryType(dir, entry, size) == DT_DIR;
+        }
+
+        bool IsDotEntry(const dirent &entry) {
+            const std::string_view name = entry.d_name;
+            return name == "." || name == "..";
+        }
+
+        /**
+         * Walks the opened directory. Every directory is opened once and its entries are stat'ed
+         * relative to it, so paths are not resolved from the root for every file.
+         * @param dir_fd Descriptor of the directory, it is closed by the walk.
+         * @param relative Path of the directory relative to the walk root, it is used as a buffer.
+         */
+        void WalkAt(int dir_fd, const PathType &root, std::string &relative, bool recursive,
+                    const BasicFileSystem::WalkVisitor &visitor) {
+            const DirPtr dir = ReadDirectory(dir_fd, root / relative);
+            const size_t base_size = relative.size();
+            while (const dirent *entry = readdir(dir.get())) {
+                if (IsDotEntry(*entry)) {
+                    continue;
+                }
+                uintmax_t size = 0;
+                const unsigned char type = EntryType(dir.get(), *entry, size);
+                if (type != DT_REG && type != DT_DIR) {
+                    continue;
+                }
+                relative.resize(base_size);
+                if (base_size != 0) {
+                    relative.push_back(SEPARATOR);
+                }
+                relative.append(entry->d_name);
+
+                if (type == DT_REG) {
+                    visitor({relative, false, size});
+                } else if (visitor({relative, true, 0}) == BasicFileSystem::WalkAction::Continue && recursive) {
+                    const int child_fd = OpenDirectoryAt(dirfd(dir.get()), entry->d_name);
+                    if (child_fd < 0) {
+                        ThrowSystemError("Can not open directory", root / relative);
+                    }
+                    WalkAt(child_fd, root, relative, recursive, visitor);
+                }
+            }
+            relative.resize(base_size);
+        }
+
+        /**
+         * Recreates subdirectories of the opened source directory in the opened destination one.
+         * Directories are created with mkdirat relative to their parent, so no path is resolved twice.
+         * @param from_fd Descriptor of the source directory, it is closed by the function.
+         */
+        void CopyTreeAt(int from_fd, int to_fd, const PathType &from) {
+            const DirPtr dir = ReadDirectory(from_fd, from);
+            while (const dirent *entry = readdir(dir.get())) {
+                if (IsDotEntry(*entry) || !IsDirectoryEntry(dir.get(), *entry)) {
+                    continue;
+                }
+                if (mkdirat(to_fd, entry->d_name, DIRECTORY_MODE) != 0 && errno != EEXIST) {
+                    ThrowSystemError("Can not create directory", from / entry->d_name);
+                }
+                const int child_from_fd = OpenDirectoryAt(dirfd(dir.get()), entry->d_name);
+                if (child_from_fd < 0) {
+                    ThrowSystemError("Can not open directory", from / entry->d_name);
+                }
+                const int child_to_fd = OpenDirectoryAt(to_fd, entry->d_name);
+                if (child_to_fd < 0) {
+                    close(child_from_fd);
+                    ThrowSystemError("Can not open directory", from / entry->d_name);
+                }
+                try {
+                    CopyTreeAt(child_from_fd, child_to_fd, from / entry->d_name);
+                } catch (...) {
+                    close(child_to_fd);
+                    throw;
+                }
+                close(child_to_fd);
+            }
+        }
+
+        /**
+         * Reads the whole file, that is opened relative to the directory (or AT_FDCWD).
+         */
+        bool ReadFileAt(int dir_fd, const char *name, uintmax_t size_hint, std::string &content) {
+            const int fd = openat(dir_fd, name, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return false;
+            }
+            // One byte more than expected is requested, so the short read proves the end of file
+            // and a file of expected size takes a single read.
+            content.resize(static_cast<size_t>(size_hint) + 1);
+            size_t used = 0;
+            while (true) {
+                const ssize_t count = read(fd, content.data() + used, content.size() - used);
+                if (count < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    close(fd);
+                    return false;
+                }
+                used += static_cast<size_t>(count);
+                if (used < content.size()) {
+                    break;
+                }
+                // File has grown since it was found.
+                content.resize(content.size() * 2);
+            }
+            content.resize(used);
+            close(fd);
+            return true;
+        }
+
+        /**
+         * Creates or truncates the file, that is opened relative to the directory (or AT_FDCWD), and writes it.
+         * @return Descriptor of the written file, that should be closed by the caller, or -1.
+         */
+        int WriteFileAt(int dir_fd, const char *name, std::string_view content) {
+            const int fd = openat(dir_fd, name, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, FILE_MODE);
+            if (fd < 0) {
+                return -1;
+            }
+            while (!content.empty()) {
+                const ssize_t count = write(fd, content.data(), content.size());
+                if (count < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    close(fd);
+                    return -1;
+                }
+                content.remove_prefix(static_cast<size_t>(count));
+            }
+            return fd;
+        }
+
+        /**
+         * Directory, that is kept open, so its files are accessed by *at system calls.
+         */
+        class NativeDirectory : public BasicFileSystem::Directory {
+         public:
+            NativeDirectory(const PathType &path, int fd, std::atomic<size_t> &open_count)
+                : Directory(path), m_fd(fd), m_open_count(open_count) {}
+
+            ~NativeDirectory() override {
+                close(m_fd);
+                --m_open_count;
+            }
+
+            int Fd() const { return m_fd; }
+
+         private:
+            int m_fd;
+            std::atomic<size_t> &m_open_count;
+        };
+
+        /**
+         * Read only stream buffer over memory, that is owned by somebody else.
+         */
+        class MemoryStreamBuf : public std::streambuf {
+         public:
+            explicit MemoryStreamBuf(std::string_view data) {
+                char *begin = const_cast<char *>(data.data());
+                setg(begin, begin, begin + data.size());
+            }
+        };
+
+        class MemoryIStream : public std::istream {
+         public:
+            explicit MemoryIStream(std::string_view data) : std::istream(&m_buf), m_buf(data) {}
+
+         private:
+            MemoryStreamBuf m_buf;
+        };
+    }  // namespace
+
+    bool BasicFileSystem::ReadAll(const PathType &path, uintmax_t size_hint, std::string &content) const {
+        auto stream = OpenRead(path);
+        if (!stream) {
+            return false;
+        }
+        content.clear();
+        content.reserve(size_hint);
+        content.assign(std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    BasicFileSystem::DirectoryShPtr BasicFileSystem::OpenDirectory(const PathType &path) const {
+        return std::make_shared<Directory>(path);
+    }
+
+    bool BasicFileSystem::ReadAllAt(const Directory &directory, const PathType &name, uintmax_t size_hint,
+                                    std::string &content) const {
+        return ReadAll(directory.Path() / name, size_hint, content);
+    }
+
+    bool BasicFileSystem::WriteAllAt(const Directory &directory, const PathType &name, std::string_view content,
+                                     bool defer_close) {
+        return WriteAll(directory.Path() / name, content, defer_close);
+    }
+
+    bool BasicFileSystem::WriteAll(const PathType &path, std::string_view content, bool) {
+        auto stream = OpenWrite(path);
+        if (!stream) {
+            return false;
+        }
+        stream->write(content.data(), static_cast<std::streamsize>(content.size()));
+        return static_cast<bool>(*stream);
+    }
+
+    BasicFileSystem::FileSystemShPtr NativeFileSystem::Instance() {
+        static const FileSystemShPtr instance = std::make_shared<NativeFileSystem>();
+        return instance;
+    }
+
+    bool NativeFileSystem::Exists(const PathType &path) const { return fs::exists(path); }
+
+    bool NativeFileSystem::IsDirectory(const PathType &path) const { return fs::is_directory(path); }
+
+    void NativeFileSystem::Walk(const PathType &root, bool recursive, const WalkVisitor &visitor) const {
+        const int root_fd = open(root.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (root_fd < 0) {
+            ThrowSystemError("Can not open directory", root);
+        }
+        std::string relative;
+        WalkAt(root_fd, root, relative, recursive, visitor);
+    }
+
+    void NativeFileSystem::CreateDirectories(const PathType &path) { fs::create_directories(path); }
+
+    void NativeFileSystem::CopyDirectoryTree(const PathType &from, const PathType &to) {
+        fs::create_directories(to);
+        const int from_fd = open(from.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (from_fd < 0) {
+            ThrowSystemError("Can not open directory", from);
+        }
+        const int to_fd = open(to.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (to_fd < 0) {
+            close(from_fd);
+            ThrowSystemError("Can not open directory", to);
+        }
+        try {
+            CopyTreeAt(from_fd, to_fd, from);
+        } catch (...) {
+            close(to_fd);
+            throw;
+        }
+        close(to_fd);
+    }
+
+    void NativeFileSystem::CopyFile(const PathType &from, const PathType &to) {
+        fs::copy(from, to, fs::copy_options::overwrite_existing);
+    }
+
+    bool NativeFileSystem::RemoveFile(const PathType &path) { return unlink(path.c_str()) == 0; }
+
+    BasicFileSystem::IStreamPtr NativeFileSystem::OpenRead(const PathType &path) const {
+        auto stream = std::make_unique<std::ifstream>(path);
+        return stream->is_open() ? std::move(stream) : nullptr;
+    }
+
+    BasicFileSystem::OStreamPtr NativeFileSystem::OpenWrite(const PathType &path) {
+        auto stream = std::make_unique<std::ofstream>(path);
+        return stream->is_open() ? std::move(stream) : nullptr;
+    }
+
+    BasicFileSystem::DirectoryShPtr NativeFileSystem::OpenDirectory(const PathType &path) const {
+        if (m_open_directories.fetch_add(1) >= MAX_OPEN_DIRECTORIES) {
+            // Descriptors are limited, other directories are accessed by paths.
+            --m_open_directories;
+            return BasicFileSystem::OpenDirectory(path);
+        }
+        const int fd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0) {
+            --m_open_directories;
+            return BasicFileSystem::OpenDirectory(path);
+        }
+        return std::make_shared<NativeDirectory>(path, fd, m_open_directories);
+    }
+
+    bool NativeFileSystem::ReadAll(const PathType &path, uintmax_t size_hint, std::string &content) const {
+        return ReadFileAt(AT_FDCWD, path.c_str(), size_hint, content);
+    }
+
+    bool NativeFileSystem::ReadAllAt(const Directory &directory, const PathType &name, uintmax_t size_hint,
+                                     std::string &content) const {
+        if (const auto *native = dynamic_cast<const NativeDirectory *>(&directory)) {
+            return ReadFileAt(native->Fd(), name.c_str(), size_hint, content);
+        }
+        return BasicFileSystem::ReadAllAt(directory, name, size_hint, content);
+    }
+
+    bool NativeFileSystem::WriteAll(const PathType &path, std::string_view content, bool defer_close) {
+        return CloseWritten(WriteFileAt(AT_FDCWD, path.c_str(), content), defer_close);
+    }
+
+    bool NativeFileSystem::WriteAllAt(const Directory &directory, const PathType &name, std::string_view content,
+                                      bool defer_close) {
+        if (const auto *native = dynamic_cast<const NativeDirectory *>(&directory)) {
+            return CloseWritten(WriteFileAt(native->Fd(), name.c_str(), content), defer_close);
+        }
+        return BasicFileSystem::WriteAllAt(directory, name, content, defer_close);
+    }
+
+    bool NativeFileSystem::CloseWritten(int fd, bool defer_close) {
+        if (fd < 0) {
+            return false;
+        }
+        if (!defer_close) {
+            return close(fd) == 0;
+        }
+        std::vector<int> batch;
+        {
+            std::lock_guard lock(m_deferred_mutex);
+            m_deferred_closes.push_back(fd);
+            if (m_deferred_closes.size() >= CLOSE_BATCH) {
+                batch.swap(m_deferred_closes);
+            }
+        }
+        for (int deferred : batch) {
+            close(deferred);
+        }
+        return true;
+    }
+
+    void NativeFileSystem::FlushDeferred() {
+        std::vector<int> batch;
+        {
+            std::lock_guard lock(m_deferred_mutex);
+            batch.swap(m_deferred_closes);
+        }
+        for (int deferred : batch) {
+            close(deferred);
+        }
+    }
+
+    DeviceIdType NativeFileSystem::DeviceOf(const PathType &path) const { return ffinder::DeviceOf(path); }
+
+    /**
+     * Output stream, that stores written data to the filesystem, when it is destroyed,
+     * like file stream flushes data on close.
+     */
+    class MemoryFileSystem::WriteStream : public std::ostringstream {
+     public:
+        WriteStream(MemoryFileSystem &file_system, std::string key)
+            : m_file_system(file_system), m_key(std::move(key)) {}
+
+        ~WriteStream() override {
+            const std::string content = str();
+            std::lock_guard lock(m_file_system.m_mutex);
+            try {
+                m_file_system.AddFileLocked(m_key, m_file_system.Store(content));
+            } catch (const fs::filesystem_error &) {
+                // Path became a directory after the stream was opened. As well as failed close
+                // of a file stream, it is not reported.
+            }
+        }
+
+     private:
+        MemoryFileSystem &m_file_system;
+        std::string m_key;
+    };
+
+    bool MemoryFileSystem::PathLess::operator()(std::string_view lhs, std::string_view rhs) const {
+        const auto rank = [](char c) { return c == SEPARATOR ? 0 : static_cast<unsigned char>(c) + 1; };
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                            [&rank](char l, char r) { return rank(l) < rank(r); });
+    }
+
+    std::string MemoryFileSystem::Key(const PathType &path) {
+        std::string key = path.lexically_normal().generic_string();
+        while (key.size() > 1 && key.back() == SEPARATOR) {
+            key.pop_back();
+        }
+        return key == "." ? std::string() : key;
+    }
+
+    std::string_view MemoryFileSystem::Store(std::string_view content) {
+        // Arena may have no blocks yet.
+        if (content.empty()) {
+            return {};
+        }
+        if (content.size() > ARENA_BLOCK_SIZE) {
+            auto block = std::make_unique<char[]>(content.size());
+            std::memcpy(block.get(), content.data(), content.size());
+            const std::string_view stored(block.get(), content.size());
+            // Large file gets its own block. The current block stays the last one, so its free
+            // space is still used.
+            m_arena.insert(m_arena.empty() ? m_arena.end() : m_arena.end() - 1, std::move(block));
+            return stored;
+        }
+
+        if (m_arena_used + content.size() > ARENA_BLOCK_SIZE) {
+            m_arena.push_back(std::make_unique<char[]>(ARENA_BLOCK_SIZE));
+            m_arena_used = 0;
+        }
+        char *data = m_arena.back().get() + m_arena_used;
+        std::memcpy(data, content.data(), content.size());
+        m_arena_used += content.size();
+        return {data, content.size()};
+    }
+
+    void MemoryFileSystem::CreateDirectoriesLocked(std::string_view key) {
+        for (size_t pos = key.find(SEPARATOR, 1); true; pos = key.find(SEPARATOR, pos + 1)) {
+            const std::string_view directory = key.substr(0, pos);
+            if (!directory.empty()) {
+                auto [node, inserted] = m_nodes.try_emplace(std::string(directory), Node{true, {}});
+                if (!node->second.is_directory) {
+                    throw fs::filesystem_error("Not a directory", PathType(directory),
+                                               std::make_error_code(std::errc::not_a_directory));
+                }
+            }
+            if (pos == std::string_view::npos) {
+                break;
+            }
+        }
+    }
+
+    void MemoryFileSystem::AddFileLocked(const std::string &key, std::string_view content) {
+        auto &node = m_nodes[key];
+        if (node.is_directory) {
+            throw fs::filesystem_error("Is a directory", PathType(key), std::make_error_code(std::errc::is_a_directory));
+        }
+        node.content = content;
+    }
+
+    void MemoryFileSystem::AddFile(const PathType &path, std::string_view content) {
+        const std::string key = Key(path);
+        std::lock_guard lock(m_mutex);
+        CreateDirectoriesLocked(PathType(key).parent_path().generic_string());
+        AddFileLocked(key, Store(content));
+    }
+
+    std::optional<std::string_view> MemoryFileSystem::ReadFile(const PathType &path) const {
+        std::lock_guard lock(m_mutex);
+        const auto node = m_nodes.find(Key(path));
+        if (node == m_nodes.end() || node->second.is_directory) {
+            return std::nullopt;
+        }
+        return node->second.content;
+    }
+
+    bool MemoryFileSystem::Exists(const PathType &path) const {
+        const std::string key = Key(path);
+        std::lock_guard lock(m_mutex);
+        return key.empty() || m_nodes.count(key) != 0;
+    }
+
+    bool MemoryFileSystem::IsDirectory(const PathType &path) const {
+        const std::string key = Key(path);
+        std::lock_guard lock(m_mutex);
+        const auto node = m_nodes.find(key);
+        return key.empty() || (node != m_nodes.end() && node->second.is_directory);
+    }
+
+    void MemoryFileSystem::Walk(const PathType &root, bool recursive, const WalkVisitor &visitor) const {
+        const std::string root_key = Key(root);
+        const std::string prefix = root_key.empty() ? std::string() : root_key + SEPARATOR;
+        struct Entry {
+            std::string key;
+            bool is_directory;
+            uintmax_t size;
+        };
+        // Entries are copied under the lock and visited without it, so the visitor may use the filesystem.
+        std::vector<Entry> entries;
+        {
+            std::lock_guard lock(m_mutex);
+            for (auto node = m_nodes.lower_bound(prefix); node != m_nodes.end() && StartsWith(node->first, prefix);
+                 ++node) {
+                if (recursive || node->first.find(SEPARATOR, prefix.size()) == std::string::npos) {
+                    entries.push_back({node->first, node->second.is_directory, node->second.content.size()});
+                }
+            }
+        }
+
+        for (auto entry = entries.begin(); entry != entries.end();) {
+            const std::string_view relative = std::string_view(entry->key).substr(prefix.size());
+            const auto action = visitor({relative, entry->is_directory, entry->size});
+            if (entry->is_directory && action == WalkAction::SkipSubtree) {
+                // Entries are in walk order, so the subtree is one range right after the directory.
+                entry = std::lower_bound(std::next(entry), entries.end(), entry->key + AFTER_SUBTREE,
+                                         [](const Entry &lhs, const std::string &rhs) { return PathLess()(lhs.key, rhs); });
+            } else {
+                ++entry;
+            }
+        }
+    }
+
+    void MemoryFileSystem::CreateDirectories(const PathType &path) {
+        const std::string key = Key(path);
+        std::lock_guard lock(m_mutex);
+        CreateDirectoriesLocked(key);
+    }
+
+    void MemoryFileSystem::CopyDirectoryTree(const PathType &from, const PathType &to) {
+        const std::string from_key = Key(from);
+        const std::string to_key = Key(to);
+        const std::string prefix = from_key.empty() ? std::string() : from_key + SEPARATOR;
+        std::lock_guard lock(m_mutex);
+        std::vector<std::string> directories = {to_key};
+        for (auto node = m_nodes.lower_bound(prefix); node != m_nodes.end() && StartsWith(node->first, prefix);
+             ++node) {
+            if (node->second.is_directory) {
+                directories.push_back((PathType(to_key) / node->first.substr(prefix.size())).generic_string());
+            }
+        }
+        for (const auto &directory : directories) {
+            CreateDirectoriesLocked(directory);
+        }
+    }
+
+    void MemoryFileSystem::CopyFile(const PathType &from, const PathType &to) {
+        const std::string from_key = Key(from);
+        const std::string to_key = Key(to);
+        std::lock_guard lock(m_mutex);
+        const auto source = m_nodes.find(from_key);
+        if (source == m_nodes.end() || source->second.is_directory) {
+            throw fs::filesystem_error("No such file", from, std::make_error_code(std::errc::no_such_file_or_directory));
+        }
+        const std::string parent = PathType(to_key).parent_path().generic_string();
+        if (!parent.empty() && m_nodes.count(parent) == 0) {
+            throw fs::filesystem_error("No such directory", to, std::make_error_code(std::errc::no_such_file_or_directory));
+        }
+        // Contents in the arena are immutable, so the copy shares them with the source.
+        AddFileLocked(to_key, source->second.content);
+    }
+
+    bool MemoryFileSystem::RemoveFile(const PathType &path) {
+        const std::string key = Key(path);
+        std::lock_guard lock(m_mutex);
+        const auto node = m_nodes.find(key);
+        if (node == m_nodes.end() || node->second.is_directory) {
+            return false;
+        }
+        // Content stays in the arena, it is freed with the whole filesystem.
+        m_nodes.erase(node);
+        return true;
+    }
+
+    BasicFileSystem::IStreamPtr MemoryFileSystem::OpenRead(const PathType &path) const {
+        const auto content = ReadFile(path);
+        if (!content) {
+            return nullptr;
+        }
+        return std::make_unique<MemoryIStream>(*content);
+    }
+
+    bool MemoryFileSystem::ReadAll(const PathType &path, uintmax_t, std::string &content) const {
+        const auto stored = ReadFile(path);
+        if (!stored) {
+            return false;
+        }
+        content.assign(*stored);
+        return true;
+    }
+
+    BasicFileSystem::OStreamPtr MemoryFileSystem::OpenWrite(const PathType &path) {
+        std::string key = Key(path);
+        const std::string parent = PathType(key).parent_path().generic_string();
+        std::lock_guard lock(m_mutex);
+        const auto node = m_nodes.find(key);
+        const auto parent_node = m_nodes.find(parent);
+        if ((node != m_nodes.end() && node->second.is_directory) ||
+            (!parent.empty() && (parent_node == m_nodes.end() || !parent_node->second.is_directory))) {
+            return nullptr;
+        }
+        return std::make_unique<WriteStream>(*this, std::move(key));
+    }
+}  // namespace ffinder
@@ -0,0 +1,64 @@
+#include "GemtextCorpus.hpp"
+
+#include <array>
+#include <string_view>
+
+namespace generator {
+    namespace {
+        // Alphabet is biased to characters, that are meaningful for the translator.
+        constexpr std::string_view ALPHABET = "abcxyz019 <>&\"'#*=`/.:?\t";
+        constexpr std::array<std::string_view, 9> PREFIXES = {"", "#", "##", "###", "* ", "=>", "=> ", ">", "```"};
+
+        std::string Repeat(std::string_view unit, size_t size) {
+            std::string result;
+            result.reserve(size + unit.size());
+            while (result.size() < size) {
+                result.append(unit);
+            }
+            return result;
+        }
+    }  // namespace
+
+    std::string GemtextCorpusGenerator::Text(size_t max_size) {
+        std::string text(Uniform(max_size + 1), ' ');
+        for (auto &c : text) {
+            c = ALPHABET[Uniform(ALPHABET.size())];
+        }
+        return text;
+    }
+
+    std::string GemtextCorpusGenerator::Line() {
+        std::string line(PREFIXES[Uniform(PREFIXES.size())]);
+        line.append(Uniform(4) == 0 ? Uniform(4) : 0, ' ');
+        if (line.rfind("=>", 0) == 0 && Uniform(2) == 0) {
+            line.append(Text(16)).append(Uniform(3), ' ').append(Text(16));
+        } else {
+            line.append(Text(Uniform(8) == 0 ? 256 : 32));
+        }
+        return line;
+    }
+
+    std::string GemtextCorpusGenerator::Document(size_t lines) {
+        std::string document;
+        for (size_t i = 0; i < lines; ++i) {
+            if (i != 0) {
+                document.push_back('\n');
+            }
+            document.append(Line());
+        }
+        return document;
+    }
+
+    std::vector<std::string> GemtextCorpusGenerator::PathologicalDocuments(size_t size) {
+        return {
+            Repeat("x", size),                            // single long paragraph
+            Repeat("<&>\"'", size),                       // every character is escaped
+            Repeat("* item\ntext\n", size),               // list is opened and closed on every line
+            Repeat("\n", size),                           // only blank lines
+            "=>" + Repeat(" ", size) + "url",             // long run of spaces before the reference
+            "=> url" + Repeat(" ", size) + "text",        // long run of spaces before the link text
+            "# " + Repeat("#", size),                     // header with long content
+            "```\n" + Repeat("<pre> & </pre>\n", size) + "```",
+        };
+    }
+}  // namespace generator
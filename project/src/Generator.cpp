@@ -1,15 +1,56 @@
 #include "Generator.hpp"
 
 #include <filesystem>
-#include <fstream>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "FSEntryFinder.hpp"
 
 namespace generator {
     namespace fs = std::filesystem;
 
-    void GemtextGenerator::CheckStreams(const std::ifstream &ifs, const std::ofstream &ofs) {
-        if (!ifs.is_open() || !ofs.is_open()) {
+    namespace {
+        /**
+         * Read only stream buffer over the page, that is already in memory.
+         */
+        class InputBuffer : public std::streambuf {
+         public:
+            explicit InputBuffer(std::string &data) { setg(data.data(), data.data(), data.data() + data.size()); }
+        };
+
+        /**
+         * Stream buffer, that appends output to the string, so its capacity is reused between pages.
+         */
+        class OutputBuffer : public std::streambuf {
+         public:
+            explicit OutputBuffer(std::string &data) : m_data(data) {}
+
+         protected:
+            int_type overflow(int_type c) override {
+                if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                    m_data.push_back(traits_type::to_char_type(c));
+                }
+                return traits_type::not_eof(c);
+            }
+
+            std::streamsize xsputn(const char *data, std::streamsize count) override {
+                m_data.append(data, static_cast<size_t>(count));
+                return count;
+            }
+
+         private:
+            std::string &m_data;
+        };
+    }  // namespace
+
+    void GemtextGenerator::CheckStreams(const ffinder::BasicFileSystem::IStreamPtr &is,
+                                        const ffinder::BasicFileSystem::OStreamPtr &os) {
+        if (!is || !os) {
             throw exceptions::ErrorFileOpen();
         }
     }
@@ -18,38 +59,173 @@ namespace generator {
         return m_finder->CreateFilesList(input_dir);
     }
 
+    void GemtextGenerator::TranslateFile(BasicTranslator &translator, const ffinder::PathType &input_file,
+                                         const ffinder::PathType &output_file) const {
+        // Input is opened first, so a missing page does not leave an empty output.
+        auto is = FileSystem().OpenRead(input_file);
+        auto os = is ? FileSystem().OpenWrite(output_file) : nullptr;
+        CheckStreams(is, os);
+        try {
+            translator.Translate(*is, *os);
+            os->flush();
+            if (is->bad() || !*os) {
+                throw exceptions::ErrorFileOpen();
+            }
+        } catch (...) {
+            // Partial page is removed, as TranslateSmallFile does not write anything on errors.
+            os.reset();
+            FileSystem().RemoveFile(output_file);
+            throw;
+        }
+    }
+
+    void GemtextGenerator::TranslateSmallFile(BasicTranslator &translator,
+                                              const ffinder::BasicFileSystem::Directory &input_dir,
+                                              const ffinder::PathType &input_name,
+                                              const ffinder::BasicFileSystem::Directory &output_dir,
+                                              const ffinder::PathType &output_name, uintmax_t size) const {
+        thread_local std::string input;
+        thread_local std::string output;
+        if (!FileSystem().ReadAllAt(input_dir, input_name, size, input)) {
+            throw exceptions::ErrorFileOpen();
+        }
+
+        InputBuffer input_buffer(input);
+        std::istream is(&input_buffer);
+        output.clear();
+        OutputBuffer output_buffer(output);
+        std::ostream os(&output_buffer);
+        translator.Translate(is, os);
+
+        if (!FileSystem().WriteAllAt(output_dir, output_name, output, SmallFiles().defer_close)) {
+            FileSystem().RemoveFile(output_dir.Path() / output_name);
+            throw exceptions::ErrorFileOpen();
+        }
+    }
+
     void GemtextGenerator::Generate(const ffinder::PathType &input_dir, const ffinder::PathType &output_dir) {
-        constexpr fs::copy_options copy_opts_files = fs::copy_options::overwrite_existing;
-        constexpr fs::copy_options copy_opts_dirs = fs::copy_options::recursive | fs::copy_options::directories_only;
         if (!IsExists(input_dir) || !IsExists(output_dir)) {
             throw exceptions::DirNotExistError();
         }
 
-        fs::copy(input_dir, output_dir, copy_opts_dirs);
+        // With rules directories are created on demand, so excluded subtrees leave no empty skeleton.
+        if (!Rules()) {
+            FileSystem().CopyDirectoryTree(input_dir, output_dir);
+        }
 
         auto entities = LoadInputDirectory(input_dir);
-        for (const auto file : entities) {
-            ffinder::PathType rel_to_input_path = fs::relative(file, input_dir);
-            if (file.extension() != GEM_EXT) {
-                fs::copy(file, output_dir / rel_to_input_path, copy_opts_files);
+        std::vector<ffinder::PathType> generated;
+        ffinder::PathType last_created_dir;
+        SizeAwareScheduler scheduler(Scheduling());
+        // Device is resolved once per input directory, it is needed to limit I/O per device.
+        std::unordered_map<ffinder::PathTable::IndexType, ffinder::DeviceIdType> devices;
+        // Small pages are read and written relative to their opened input and output directories.
+        std::unordered_map<ffinder::PathTable::IndexType, std::pair<DirectoryShPtr, DirectoryShPtr>> directories;
+        for (const auto &file : entities) {
+            // Relative path is restored from the path table, no filesystem calls are needed.
+            ffinder::PathType rel_to_input_path = file.Relative();
+            const bool skipped = Rules() && Rules()->IsSkipped(rel_to_input_path.native());
+            if (skipped || !Partitioner().Owns(rel_to_input_path)) {
+                continue;
+            }
+
+            if (Rules() && rel_to_input_path.parent_path() != last_created_dir) {
+                last_created_dir = rel_to_input_path.parent_path();
+                FileSystem().CreateDirectories(output_dir / last_created_dir);
+            }
+
+            if (Route(rel_to_input_path) == COPY_TRANSLATOR) {
+                auto [device, inserted] = devices.try_emplace(file.Parent(), 0);
+                if (inserted) {
+                    device->second = FileSystem().DeviceOf(input_dir / rel_to_input_path.parent_path());
+                }
+                scheduler.AddIoJob(file.Size(), device->second,
+                                   [this, from = input_dir / rel_to_input_path, to = output_dir / rel_to_input_path] {
+                                       FileSystem().CopyFile(from, to);
+                                   });
+                generated.push_back(rel_to_input_path);
             } else {
                 // Create file with new extension
                 ffinder::PathType file_new_extension = rel_to_input_path;
                 file_new_extension.replace_extension(HTML_EXT);
-                std::ofstream ofs(output_dir / file_new_extension);
-                std::ifstream ifs(file);
-                CheckStreams(ifs, ofs);
-                auto translator = GetTranslator(file);
-                translator->Translate(ifs, ofs);
+                if (file.Size() < SmallFiles().max_size) {
+                    auto [dirs, inserted] = directories.try_emplace(file.Parent());
+                    if (inserted) {
+                        dirs->second = {FileSystem().OpenDirectory(input_dir / rel_to_input_path.parent_path()),
+                                        FileSystem().OpenDirectory(output_dir / rel_to_input_path.parent_path())};
+                    }
+                    scheduler.AddCpuJob(file.Size(), [this, translator = GetTranslator(rel_to_input_path),
+                                                      dirs = dirs->second, from = rel_to_input_path.filename(),
+                                                      to = file_new_extension.filename(), size = file.Size()] {
+                        TranslateSmallFile(*translator, *dirs.first, from, *dirs.second, to, size);
+                    });
+                } else {
+                    scheduler.AddCpuJob(file.Size(), [this, translator = GetTranslator(rel_to_input_path),
+                                                      from = input_dir / rel_to_input_path,
+                                                      to = output_dir / file_new_extension] {
+                        TranslateFile(*translator, from, to);
+                    });
+                }
+                generated.push_back(file_new_extension);
             }
         }
+
+        try {
+            scheduler.Run();
+        } catch (...) {
+            FileSystem().FlushDeferred();
+            throw;
+        }
+        FileSystem().FlushDeferred();
+
+        if (Sharded()) {
+            WriteManifest(output_dir, generated);
+        }
+    }
+
+    void GemtextGenerator::WriteManifest(const ffinder::PathType &output_dir,
+                                         const std::vector<ffinder::PathType> &generated) const {
+        auto os = FileSystem().OpenWrite(ShardManifestPath(output_dir, Partitioner().Spec()));
+        if (!os) {
+            throw exceptions::ErrorFileOpen();
+        }
+        for (const auto &file : generated) {
+            *os << file.generic_string() << '\n';
+        }
+    }
+
+    void GemtextGenerator::SetRules(const ffinder::RuleSet::RuleSetShPtr &rules) {
+        if (rules) {
+            for (const auto &rule : rules->Rules()) {
+                if (rule.action == ffinder::RuleAction::Translate && rule.translator != GEMTEXT_TRANSLATOR &&
+                    rule.translator != COPY_TRANSLATOR) {
+                    throw exceptions::UnknownTranslatorError();
+                }
+            }
+        }
+        BasicWebsiteGenerator::SetRules(rules);
+    }
+
+    std::string_view GemtextGenerator::Route(const ffinder::PathType &rel_path) const {
+        if (Rules()) {
+            if (auto translator = Rules()->TranslatorFor(rel_path.native())) {
+                return *translator;
+            }
+        }
+        return rel_path.extension() == GEM_EXT ? GEMTEXT_TRANSLATOR : COPY_TRANSLATOR;
     }
 
     BasicTranslator::TranslatorShPtr GemtextGenerator::GetTranslator(const ffinder::PathType &file) {
-        if (file.extension() == GEM_EXT) {
-            return CreateTranslator<GemToHTMLTranslator>();
+        if (Route(file) == GEMTEXT_TRANSLATOR) {
+            if (!m_gemtext_translator) {
+                m_gemtext_translator = CreateTranslator<GemToHTMLTranslator>();
+            }
+            return m_gemtext_translator;
         }
 
-        return CreateTranslator<DefaultTranslator>();
+        if (!m_copy_translator) {
+            m_copy_translator = CreateTranslator<DefaultTranslator>();
+        }
+        return m_copy_translator;
     }
 }  // namespace generator
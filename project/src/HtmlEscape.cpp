@@ -0,0 +1,98 @@
+#include "HtmlEscape.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace generator {
+    namespace {
+        constexpr size_t SIMD_WIDTH = 16;
+
+        constexpr bool IsEscapable(char c, EscapeContext context) {
+            switch (c) {
+                case '<':
+                case '>':
+                case '&':
+                    return true;
+                case '"':
+                case '\'':
+                    return context == EscapeContext::Attribute;
+                default:
+                    return false;
+            }
+        }
+
+        constexpr std::string_view Replacement(char c) {
+            switch (c) {
+                case '<':
+                    return "&lt;";
+                case '>':
+                    return "&gt;";
+                case '&':
+                    return "&amp;";
+                case '"':
+                    return "&quot;";
+                case '\'':
+                    return "&#39;";
+                default:
+                    return {};
+            }
+        }
+
+        size_t FindEscapableScalar(std::string_view data, size_t pos, EscapeContext context) {
+            for (; pos < data.size(); ++pos) {
+                if (IsEscapable(data[pos], context)) {
+                    return pos;
+                }
+            }
+            return std::string_view::npos;
+        }
+    }  // namespace
+
+    size_t FindEscapable(std::string_view data, size_t pos, EscapeContext context) {
+#if defined(__SSE2__)
+        const __m128i lt = _mm_set1_epi8('<');
+        const __m128i gt = _mm_set1_epi8('>');
+        const __m128i amp = _mm_set1_epi8('&');
+        const __m128i quot = _mm_set1_epi8('"');
+        const __m128i apos = _mm_set1_epi8('\'');
+        const bool attribute = context == EscapeContext::Attribute;
+
+        for (; pos + SIMD_WIDTH <= data.size(); pos += SIMD_WIDTH) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data.data() + pos));
+            __m128i found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, lt), _mm_cmpeq_epi8(chunk, gt)),
+                                         _mm_cmpeq_epi8(chunk, amp));
+            if (attribute) {
+                found = _mm_or_si128(found, _mm_or_si128(_mm_cmpeq_epi8(chunk, quot), _mm_cmpeq_epi8(chunk, apos)));
+            }
+            const int mask = _mm_movemask_epi8(found);
+            if (mask != 0) {
+                return pos + __builtin_ctz(static_cast<unsigned>(mask));
+            }
+        }
+#endif
+        // Tail (or whole input without SSE2) is checked character by character.
+        return FindEscapableScalar(data, pos, context);
+    }
+
+    void AppendEscaped(std::string &out, std::string_view data, EscapeContext context) {
+        size_t clean_begin = 0;
+        for (size_t pos = FindEscapable(data, 0, context); pos != std::string_view::npos;
+             pos = FindEscapable(data, clean_begin, context)) {
+            out.append(data, clean_begin, pos - clean_begin);
+            out.append(Replacement(data[pos]));
+            clean_begin = pos + 1;
+        }
+        out.append(data, clean_begin);
+    }
+
+    void AppendEscapedScalar(std::string &out, std::string_view data, EscapeContext context) {
+        for (const char c : data) {
+            if (IsEscapable(c, context)) {
+                out.append(Replacement(c));
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+}  // namespace generator
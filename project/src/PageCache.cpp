@@ -0,0 +1,68 @@
+#include "PageCache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace generator {
+    PageCache::PageCache(size_t capacity, size_t shards) {
+        shards = std::max<size_t>(shards, 1);
+        m_shard_capacity = capacity / shards;
+        for (size_t i = 0; i < shards; ++i) {
+            m_shards.push_back(std::make_unique<Shard>());
+        }
+    }
+
+    PageCache::Shard &PageCache::ShardOf(const std::string &key) {
+        return *m_shards[std::hash<std::string>{}(key) % m_shards.size()];
+    }
+
+    void PageCache::Erase(Shard &shard, std::list<Entry>::iterator entry) {
+        shard.size -= entry->content->size();
+        shard.index.erase(entry->key);
+        shard.lru.erase(entry);
+    }
+
+    PageCache::ContentPtr PageCache::Get(const std::string &key, TimeType mtime) {
+        Shard &shard = ShardOf(key);
+        std::lock_guard lock(shard.mutex);
+        const auto found = shard.index.find(key);
+        if (found == shard.index.end()) {
+            return nullptr;
+        }
+        if (found->second->mtime != mtime) {
+            Erase(shard, found->second);
+            return nullptr;
+        }
+        shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+        return found->second->content;
+    }
+
+    void PageCache::Put(const std::string &key, TimeType mtime, ContentPtr content) {
+        Shard &shard = ShardOf(key);
+        std::lock_guard lock(shard.mutex);
+        if (const auto found = shard.index.find(key); found != shard.index.end()) {
+            Erase(shard, found->second);
+        }
+        if (content->size() > m_shard_capacity) {
+            // Page, that does not fit into the shard, would evict everything and be evicted itself.
+            return;
+        }
+
+        shard.size += content->size();
+        shard.lru.push_front({key, mtime, std::move(content)});
+        shard.index.emplace(key, shard.lru.begin());
+        while (shard.size > m_shard_capacity) {
+            Erase(shard, std::prev(shard.lru.end()));
+        }
+    }
+
+    size_t PageCache::Size() const {
+        size_t size = 0;
+        for (const auto &shard : m_shards) {
+            std::lock_guard lock(shard->mutex);
+            size += shard->size;
+        }
+        return size;
+    }
+}  // namespace generator
@@ -0,0 +1,202 @@
+#include "PathTable.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace ffinder {
+    namespace {
+        constexpr size_t MIN_SLOTS = 16;
+    }  // namespace
+
+    PathTable::PathTable(std::initializer_list<PathType> paths) {
+        for (const auto &path : paths) {
+            emplace(path);
+        }
+    }
+
+    bool PathTable::emplace(const PathType &path) {
+        const std::string_view full = path.native();
+        const std::string_view root = m_root.native();
+        if (root.empty()) {
+            return EmplaceRelative(full);
+        }
+
+        // Paths produced by directory iterators start with the root, so relative path is just a suffix.
+        const bool root_ends_with_separator = root.back() == SEPARATOR;
+        if (full.size() > root.size() && full.substr(0, root.size()) == root &&
+            (root_ends_with_separator || full[root.size()] == SEPARATOR)) {
+            return EmplaceRelative(full.substr(root.size()));
+        }
+        return EmplaceRelative(path.lexically_relative(m_root).generic_string());
+    }
+
+    bool PathTable::EmplaceRelative(std::string_view relative, uintmax_t size) {
+        while (!relative.empty() && relative.front() == SEPARATOR && !m_root.empty()) {
+            relative.remove_prefix(1);
+        }
+
+        IndexType node = NO_INDEX;
+        size_t pos = 0;
+        while (true) {
+            const size_t next = relative.find(SEPARATOR, pos);
+            const bool last = next == std::string_view::npos;
+            const std::string_view name = relative.substr(pos, last ? std::string_view::npos : next - pos);
+            // Empty first component is kept, it stands for root directory of absolute path.
+            if (!name.empty() || (pos == 0 && !last)) {
+                node = Intern(node, name);
+            }
+            if (last) {
+                break;
+            }
+            // Path of a file can not be a directory of another file.
+            if (node != NO_INDEX) {
+                if (m_nodes[node].is_file) {
+                    return false;
+                }
+                m_nodes[node].is_directory = true;
+            }
+            pos = next + 1;
+        }
+
+        if (node == NO_INDEX || m_nodes[node].is_file || m_nodes[node].is_directory) {
+            return false;
+        }
+        m_nodes[node].is_file = true;
+        m_nodes[node].size = size;
+        m_files.push_back(node);
+        m_sorted = false;
+        return true;
+    }
+
+    size_t PathTable::Hash(IndexType parent, std::string_view name) {
+        // FNV-1a over the name, mixed with parent index.
+        size_t hash = 14695981039346656037ULL ^ (static_cast<size_t>(parent) * 0x9E3779B97F4A7C15ULL);
+        for (const char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    void PathTable::Rehash(size_t slots_count) {
+        m_slots.assign(slots_count, NO_INDEX);
+        const size_t mask = slots_count - 1;
+        for (IndexType index = 0; index < m_nodes.size(); ++index) {
+            size_t slot = Hash(m_nodes[index].parent, Name(index)) & mask;
+            while (m_slots[slot] != NO_INDEX) {
+                slot = (slot + 1) & mask;
+            }
+            m_slots[slot] = index;
+        }
+    }
+
+    PathTable::IndexType PathTable::Intern(IndexType parent, std::string_view name) {
+        // Load factor is kept below 1/2, slots count is power of two.
+        if ((m_nodes.size() + 1) * 2 > m_slots.size()) {
+            Rehash(std::max(MIN_SLOTS, m_slots.size() * 2));
+        }
+
+        const size_t mask = m_slots.size() - 1;
+        size_t slot = Hash(parent, name) & mask;
+        for (; m_slots[slot] != NO_INDEX; slot = (slot + 1) & mask) {
+            const IndexType candidate = m_slots[slot];
+            if (m_nodes[candidate].parent == parent && Name(candidate) == name) {
+                return candidate;
+            }
+        }
+
+        const auto index = static_cast<IndexType>(m_nodes.size());
+        const auto name_offset = static_cast<IndexType>(m_arena.size());
+        m_nodes.push_back({parent, name_offset, static_cast<IndexType>(name.size()), false, false, 0});
+        m_arena.append(name);
+        m_slots[slot] = index;
+        return index;
+    }
+
+    std::string_view PathTable::Name(IndexType node) const {
+        return std::string_view(m_arena).substr(m_nodes[node].name_offset, m_nodes[node].name_size);
+    }
+
+    std::string PathTable::RelativeString(IndexType node) const {
+        size_t size = 0;
+        size_t depth = 0;
+        for (IndexType current = node; current != NO_INDEX; current = m_nodes[current].parent) {
+            size += m_nodes[current].name_size;
+            ++depth;
+        }
+
+        // Fill the string from the end, so components are written without reversing.
+        std::string result(size + depth - 1, SEPARATOR);
+        size_t end = result.size();
+        for (IndexType current = node; current != NO_INDEX; current = m_nodes[current].parent) {
+            const std::string_view name = Name(current);
+            end -= name.size();
+            std::copy(name.begin(), name.end(), result.begin() + end);
+            end -= (end != 0);
+        }
+        return result;
+    }
+
+    void PathTable::Sort() const {
+        // Preorder traversal of the tree with children sorted by name gives component-wise
+        // lexicographical order of paths, so only names of siblings are ever compared.
+        const size_t nodes_count = m_nodes.size();
+        const size_t virtual_root = nodes_count;
+        auto bucket = [this, virtual_root](IndexType node) {
+            return m_nodes[node].parent == NO_INDEX ? virtual_root : m_nodes[node].parent;
+        };
+
+        std::vector<IndexType> offsets(nodes_count + 3, 0);
+        for (IndexType node = 0; node < nodes_count; ++node) {
+            ++offsets[bucket(node) + 2];
+        }
+        for (size_t i = 2; i < offsets.size(); ++i) {
+            offsets[i] += offsets[i - 1];
+        }
+        std::vector<IndexType> children(nodes_count);
+        for (IndexType node = 0; node < nodes_count; ++node) {
+            children[offsets[bucket(node) + 1]++] = node;
+        }
+        for (size_t parent = 0; parent <= nodes_count; ++parent) {
+            std::sort(children.begin() + offsets[parent], children.begin() + offsets[parent + 1],
+                      [this](IndexType lhs, IndexType rhs) { return Name(lhs) < Name(rhs); });
+        }
+
+        m_files.clear();
+        std::vector<IndexType> stack(children.rbegin() + (nodes_count - offsets[virtual_root + 1]),
+                                     children.rbegin() + (nodes_count - offsets[virtual_root]));
+        while (!stack.empty()) {
+            const IndexType node = stack.back();
+            stack.pop_back();
+            if (m_nodes[node].is_file) {
+                m_files.push_back(node);
+            }
+            stack.insert(stack.end(), children.rbegin() + (nodes_count - offsets[node + 1]),
+                         children.rbegin() + (nodes_count - offsets[node]));
+        }
+        m_sorted = true;
+    }
+
+    PathTable::ConstIterator PathTable::begin() const {
+        if (!m_sorted) {
+            Sort();
+        }
+        return {*this, m_files.cbegin()};
+    }
+
+    PathTable::ConstIterator PathTable::end() const {
+        if (!m_sorted) {
+            Sort();
+        }
+        return {*this, m_files.cend()};
+    }
+
+    bool PathTable::operator==(const PathTable &other) const {
+        if (size() != other.size()) {
+            return false;
+        }
+        return std::equal(begin(), end(), other.begin(),
+                          [](const Entry &lhs, const Entry &rhs) { return lhs.Path() == rhs.Path(); });
+    }
+}  // namespace ffinder
@@ -0,0 +1,517 @@
+#include "PreviewServer.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "Translator.hpp"
+
+namespace generator {
+    namespace {
+        constexpr std::string_view HEADERS_END = "\r\n\r\n";
+        constexpr std::string_view LINE_END = "\r\n";
+
+        bool SendAll(int fd, std::string_view data) {
+            while (!data.empty()) {
+                const ssize_t sent = send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+                if (sent < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return false;
+                }
+                data.remove_prefix(static_cast<size_t>(sent));
+            }
+            return true;
+        }
+
+        std::string_view StatusText(int status) {
+            switch (status) {
+                case 200:
+                    return "OK";
+                case 301:
+                    return "Moved Permanently";
+                case 400:
+                    return "Bad Request";
+                case 404:
+                    return "Not Found";
+                case 405:
+                    return "Method Not Allowed";
+                case 431:
+                    return "Request Header Fields Too Large";
+                default:
+                    return "Internal Server Error";
+            }
+        }
+
+        std::string_view ContentType(std::string_view extension) {
+            if (extension == ".html" || extension == ".htm") {
+                return "text/html; charset=utf-8";
+            } else if (extension == ".gmi") {
+                return "text/gemini; charset=utf-8";
+            } else if (extension == ".css") {
+                return "text/css; charset=utf-8";
+            } else if (extension == ".js") {
+                return "text/javascript; charset=utf-8";
+            } else if (extension == ".txt") {
+                return "text/plain; charset=utf-8";
+            } else if (extension == ".png") {
+                return "image/png";
+            } else if (extension == ".jpg" || extension == ".jpeg") {
+                return "image/jpeg";
+            } else if (extension == ".gif") {
+                return "image/gif";
+            } else if (extension == ".svg") {
+                return "image/svg+xml";
+            }
+            return "application/octet-stream";
+        }
+
+        std::string Headers(int status, std::string_view content_type, uintmax_t length, bool keep_alive) {
+            std::string headers = "HTTP/1.1 " + std::to_string(status) + " ";
+            headers.append(StatusText(status));
+            headers.append("\r\nContent-Type: ").append(content_type);
+            headers.append("\r\nContent-Length: ").append(std::to_string(length));
+            headers.append("\r\nConnection: ").append(keep_alive ? "keep-alive" : "close");
+            headers.append(LINE_END);
+            return headers;
+        }
+
+        bool SendError(int fd, int status, bool keep_alive) {
+            const std::string body = std::to_string(status) + " " + std::string(StatusText(status)) + "\n";
+            return SendAll(fd, Headers(status, "text/plain; charset=utf-8", body.size(), keep_alive) +
+                                   std::string(LINE_END) + body) &&
+                   keep_alive;
+        }
+
+        int HexValue(char c) {
+            if (c >= '0' && c <= '9') {
+                return c - '0';
+            }
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+        }
+
+        /**
+         * @return Path of the request target without query and fragment, still percent-encoded.
+         */
+        std::string_view TargetPath(std::string_view target) { return target.substr(0, target.find_first_of("?#")); }
+
+        /**
+         * Decodes path of the request target. Targets, that may leave the served directory or contain
+         * control characters, are rejected.
+         * @return Decoded path starting with '/' or std::nullopt, if target is invalid.
+         */
+        std::optional<std::string> DecodeTarget(std::string_view target) {
+            target = TargetPath(target);
+            if (target.empty() || target.front() != '/') {
+                return std::nullopt;
+            }
+
+            std::string path;
+            path.reserve(target.size());
+            for (size_t i = 0; i < target.size(); ++i) {
+                if (target[i] != '%') {
+                    path.push_back(target[i]);
+                    continue;
+                }
+                const int high = i + 2 < target.size() ? HexValue(target[i + 1]) : -1;
+                const int low = high >= 0 ? HexValue(target[i + 2]) : -1;
+                if (low < 0 || (high == 0 && low == 0)) {
+                    return std::nullopt;
+                }
+                path.push_back(static_cast<char>(high * 16 + low));
+                i += 2;
+            }
+            if (std::any_of(path.begin(), path.end(), [](unsigned char c) { return std::iscntrl(c); })) {
+                return std::nullopt;
+            }
+
+            for (size_t begin = 1; begin <= path.size();) {
+                const size_t end = std::min(path.find('/', begin), path.size());
+                if (std::string_view(path).substr(begin, end - begin) == "..") {
+                    return std::nullopt;
+                }
+                begin = end + 1;
+            }
+            return path;
+        }
+
+        std::string Lowercase(std::string_view string) {
+            std::string result(string);
+            std::transform(result.begin(), result.end(), result.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return result;
+        }
+
+        bool EndsWith(std::string_view string, std::string_view suffix) {
+            return string.size() >= suffix.size() && string.substr(string.size() - suffix.size()) == suffix;
+        }
+
+        PageCache::TimeType ModificationTime(const struct stat &st) {
+            constexpr PageCache::TimeType NANOSECONDS = 1000000000;
+            return static_cast<PageCache::TimeType>(st.st_mtim.tv_sec) * NANOSECONDS + st.st_mtim.tv_nsec;
+        }
+    }  // namespace
+
+    PreviewServer::PreviewServer(const PathType &root, const PreviewServerConfig &config)
+        : m_root(root), m_config(config), m_cache(config.cache_capacity) {
+        std::error_code error;
+        const PathType canonical = std::filesystem::canonical(root, error);
+        if (!error) {
+            m_root = canonical;
+        }
+    }
+
+    PreviewServer::~PreviewServer() { Stop(); }
+
+    uint16_t PreviewServer::Start() {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(m_config.port);
+        if (inet_pton(AF_INET, m_config.address.c_str(), &address.sin_addr) != 1) {
+            throw exceptions::ServerStartError();
+        }
+
+        m_listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        m_stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        const int reuse = 1;
+        socklen_t address_size = sizeof(address);
+        epoll_event listen_event{EPOLLIN, {}};
+        listen_event.data.fd = m_listen_fd;
+        epoll_event stop_event{EPOLLIN, {}};
+        stop_event.data.fd = m_stop_fd;
+        if (m_listen_fd < 0 || m_stop_fd < 0 || m_epoll_fd < 0 ||
+            setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0 ||
+            bind(m_listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+            listen(m_listen_fd, SOMAXCONN) != 0 ||
+            getsockname(m_listen_fd, reinterpret_cast<sockaddr *>(&address), &address_size) != 0 ||
+            epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_listen_fd, &listen_event) != 0 ||
+            epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_stop_fd, &stop_event) != 0) {
+            for (int *fd : {&m_listen_fd, &m_stop_fd, &m_epoll_fd}) {
+                if (*fd >= 0) {
+                    close(*fd);
+                }
+                *fd = -1;
+            }
+            throw exceptions::ServerStartError();
+        }
+
+        m_stopping = false;
+        m_loop = std::thread(&PreviewServer::Loop, this);
+        for (size_t i = 0; i < std::max<size_t>(m_config.workers, 1); ++i) {
+            m_workers.emplace_back(&PreviewServer::Work, this);
+        }
+        return ntohs(address.sin_port);
+    }
+
+    void PreviewServer::Run() {
+        Start();
+        Wait();
+    }
+
+    void PreviewServer::Wait() {
+        std::unique_lock lock(m_mutex);
+        m_stopped.wait(lock, [this] { return m_stopping; });
+    }
+
+    void PreviewServer::Stop() {
+        if (!m_loop.joinable()) {
+            return;
+        }
+
+        const uint64_t signal = 1;
+        while (write(m_stop_fd, &signal, sizeof(signal)) < 0 && errno == EINTR) {
+        }
+        m_loop.join();
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+            // Workers block in recv of connections, that sent an incomplete request. Shutdown wakes them
+            // up at once instead of after the socket timeout.
+            for (int fd : m_connections) {
+                shutdown(fd, SHUT_RDWR);
+            }
+        }
+        m_ready.notify_all();
+        m_stopped.notify_all();
+        for (auto &worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+
+        // Workers are joined, so remaining connections are idle ones, that wait in epoll.
+        for (int fd : m_connections) {
+            close(fd);
+        }
+        m_connections.clear();
+        m_ready_connections.clear();
+        for (int *fd : {&m_listen_fd, &m_stop_fd, &m_epoll_fd}) {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+
+    void PreviewServer::Loop() {
+        epoll_event events[MAX_EVENTS];
+        while (true) {
+            const int count = epoll_wait(m_epoll_fd, events, MAX_EVENTS, -1);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            for (int i = 0; i < count; ++i) {
+                const int fd = events[i].data.fd;
+                if (fd == m_stop_fd) {
+                    return;
+                } else if (fd == m_listen_fd) {
+                    Accept();
+                } else {
+                    // Connections are registered as one-shot, so the connection is owned by one worker
+                    // until it is re-armed.
+                    std::lock_guard lock(m_mutex);
+                    m_ready_connections.push_back(fd);
+                    m_ready.notify_one();
+                }
+            }
+        }
+    }
+
+    void PreviewServer::Accept() {
+        while (true) {
+            const int fd = accept4(m_listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (fd < 0) {
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                return;
+            }
+
+            // Workers use blocking I/O, timeouts protect them from clients, that stop in the middle.
+            const timeval timeout{SOCKET_TIMEOUT_SECONDS, 0};
+            const int no_delay = 1;
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+            std::lock_guard lock(m_mutex);
+            epoll_event event{EPOLLIN | EPOLLRDHUP | EPOLLONESHOT, {}};
+            event.data.fd = fd;
+            if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+                close(fd);
+                continue;
+            }
+            m_connections.insert(fd);
+        }
+    }
+
+    void PreviewServer::Work() {
+        while (true) {
+            int fd = -1;
+            {
+                std::unique_lock lock(m_mutex);
+                m_ready.wait(lock, [this] { return m_stopping || !m_ready_connections.empty(); });
+                if (m_stopping) {
+                    return;
+                }
+                fd = m_ready_connections.front();
+                m_ready_connections.pop_front();
+            }
+
+            bool keep_alive = false;
+            try {
+                keep_alive = HandleConnection(fd);
+            } catch (const std::exception &) {
+                // Connection is closed, the server continues to serve other clients.
+            }
+
+            epoll_event event{EPOLLIN | EPOLLRDHUP | EPOLLONESHOT, {}};
+            event.data.fd = fd;
+            if (!keep_alive || epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, fd, &event) != 0) {
+                Close(fd);
+            }
+        }
+    }
+
+    void PreviewServer::Close(int fd) {
+        std::lock_guard lock(m_mutex);
+        m_connections.erase(fd);
+        close(fd);
+    }
+
+    bool PreviewServer::HandleConnection(int fd) {
+        std::string buffer;
+        char chunk[4096];
+        // Pipelined requests, that arrived together, are answered one by one.
+        do {
+            size_t headers_end;
+            while ((headers_end = buffer.find(HEADERS_END)) == std::string::npos) {
+                if (buffer.size() > MAX_REQUEST_SIZE) {
+                    return SendError(fd, 431, false);
+                }
+                const ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+                if (received < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (received <= 0) {
+                    return false;
+                }
+                buffer.append(chunk, static_cast<size_t>(received));
+            }
+            const std::string request = buffer.substr(0, headers_end);
+            buffer.erase(0, headers_end + HEADERS_END.size());
+            if (!Respond(fd, request)) {
+                return false;
+            }
+        } while (!buffer.empty());
+        return true;
+    }
+
+    bool PreviewServer::Respond(int fd, const std::string &request) {
+        std::istringstream lines(request);
+        std::string method, target, version;
+        if (!(lines >> method >> target >> version) || version.rfind("HTTP/1.", 0) != 0) {
+            return SendError(fd, 400, false);
+        }
+
+        bool keep_alive = version == "HTTP/1.1";
+        for (std::string line; std::getline(lines, line);) {
+            const std::string header = Lowercase(line);
+            if (header.rfind("connection:", 0) == 0) {
+                if (header.find("close") != std::string::npos) {
+                    keep_alive = false;
+                } else if (header.find("keep-alive") != std::string::npos) {
+                    keep_alive = true;
+                }
+            }
+        }
+
+        if (method != "GET" && method != "HEAD") {
+            // Request body is not read, so the connection can not be reused.
+            return SendError(fd, 405, false);
+        }
+        const auto path = DecodeTarget(target);
+        if (!path) {
+            return SendError(fd, 400, keep_alive);
+        }
+        return ServeFile(fd, *path, TargetPath(target), method == "HEAD", keep_alive);
+    }
+
+    bool PreviewServer::ServeFile(int fd, const std::string &path, std::string_view encoded_path, bool head,
+                                  bool keep_alive) {
+        std::string relative = path.substr(1);
+        if (relative.empty() || relative.back() == '/') {
+            relative.append(INDEX_PAGE);
+        }
+        const PathType requested = m_root / relative;
+
+        struct stat st {};
+        if (EndsWith(relative, HTML_EXTENSION)) {
+            const auto source = Resolve(PathType(requested).replace_extension(GEMTEXT_EXTENSION));
+            if (source && stat(source->c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+                return ServePage(fd, *source, ModificationTime(st), head, keep_alive);
+            }
+        }
+
+        const auto resolved = Resolve(requested);
+        // Resolved path has no symbolic links, so following one at this point means it was just replaced.
+        const int file = resolved ? open(resolved->c_str(), O_RDONLY | O_CLOEXEC | O_NOFOLLOW) : -1;
+        if (file < 0) {
+            return SendError(fd, 404, keep_alive);
+        }
+        if (fstat(file, &st) != 0 || !(S_ISREG(st.st_mode) || S_ISDIR(st.st_mode))) {
+            close(file);
+            return SendError(fd, 404, keep_alive);
+        }
+        if (S_ISDIR(st.st_mode)) {
+            // Relative links of the index page are resolved against the directory only with the trailing slash.
+            // Location repeats the target as it was received, so decoded characters never reach the headers.
+            close(file);
+            return SendAll(fd, Headers(301, "text/plain; charset=utf-8", 0, keep_alive) + "Location: " +
+                                   std::string(encoded_path) + "/\r\n\r\n") &&
+                   keep_alive;
+        }
+
+        const auto size = static_cast<size_t>(st.st_size);
+        bool sent = SendAll(fd, Headers(200, ContentType(resolved->extension().native()), size, keep_alive) +
+                                    std::string(LINE_END));
+        // Assets are sent by the kernel directly from the page cache without copying to user space.
+        for (off_t offset = 0; sent && !head && static_cast<size_t>(offset) < size;) {
+            const ssize_t written = sendfile(fd, file, &offset, size - static_cast<size_t>(offset));
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            sent = written > 0;
+        }
+        close(file);
+        return sent && keep_alive;
+    }
+
+    std::optional<PreviewServer::PathType> PreviewServer::Resolve(const PathType &path) const {
+        char resolved[PATH_MAX];
+        if (realpath(path.c_str(), resolved) == nullptr) {
+            return std::nullopt;
+        }
+        // Symbolic links inside the served directory may point outside of it.
+        const std::string_view root = m_root.native();
+        const std::string_view result = resolved;
+        if (result != root && !(result.substr(0, root.size()) == root &&
+                                (root.back() == '/' || result.substr(root.size(), 1) == "/"))) {
+            return std::nullopt;
+        }
+        return PathType(resolved);
+    }
+
+    bool PreviewServer::ServePage(int fd, const PathType &source, PageCache::TimeType mtime, bool head,
+                                  bool keep_alive) {
+        auto content = m_cache.Get(source.native(), mtime);
+        if (!content) {
+            try {
+                content = Translate(source);
+            } catch (const exceptions::TranslatorError &) {
+                return SendError(fd, 500, keep_alive);
+            }
+            m_cache.Put(source.native(), mtime, content);
+        }
+
+        std::string response = Headers(200, ContentType(HTML_EXTENSION), content->size(), keep_alive);
+        response.append(LINE_END);
+        if (!head) {
+            response.append(*content);
+        }
+        return SendAll(fd, response) && keep_alive;
+    }
+
+    PageCache::ContentPtr PreviewServer::Translate(const PathType &source) const {
+        std::ifstream is(source);
+        if (!is.is_open()) {
+            throw exceptions::InvalidStreamError();
+        }
+        std::ostringstream os;
+        GemToHTMLTranslator translator;
+        translator.Translate(is, os);
+        return std::make_shared<const std::string>(std::move(os).str());
+    }
+}  // namespace generator
@@ -0,0 +1,326 @@
+#include "Rules.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace ffinder {
+    namespace {
+        constexpr char SEPARATOR = '/';
+        constexpr char COMMENT = '#';
+
+        constexpr std::string_view INCLUDE_KEYWORD = "include";
+        constexpr std::string_view EXCLUDE_KEYWORD = "exclude";
+        constexpr std::string_view SKIP_KEYWORD = "skip";
+        constexpr std::string_view TRANSLATE_KEYWORD = "translate";
+
+        bool StartsWith(std::string_view string, std::string_view prefix) {
+            return string.substr(0, prefix.size()) == prefix;
+        }
+
+        bool EndsWith(std::string_view string, std::string_view suffix) {
+            return string.size() >= suffix.size() && string.substr(string.size() - suffix.size()) == suffix;
+        }
+
+        /**
+         * Checks whether the pattern matches some directory, that contains the path.
+         */
+        bool MatchesAncestor(const GlobPattern &pattern, std::string_view rel_path) {
+            for (size_t pos = rel_path.find(SEPARATOR); pos != std::string_view::npos;
+                 pos = rel_path.find(SEPARATOR, pos + 1)) {
+                if (pattern.MatchDirectory(rel_path.substr(0, pos))) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }  // namespace
+
+    GlobPattern::GlobPattern(std::string_view pattern) : m_source(pattern) {
+        if (StartsWith(pattern, "/")) {
+            // Leading separator anchors pattern to the input directory.
+            pattern.remove_prefix(1);
+        } else {
+            m_basename_only = pattern.find(SEPARATOR) == std::string_view::npos;
+        }
+
+        std::vector<Token> tokens;
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            const char c = pattern[i];
+            Token token{TokenType::Literal};
+            if (c == '*') {
+                if (i + 1 < pattern.size() && pattern[i + 1] == '*') {
+                    ++i;
+                    token.type = TokenType::DoubleStar;
+                    if (i + 1 < pattern.size() && pattern[i + 1] == SEPARATOR) {
+                        ++i;
+                        tokens.push_back({TokenType::DirStar});
+                        tokens.push_back({TokenType::DoubleStar});
+                        token.type = TokenType::DirSeparator;
+                    }
+                } else {
+                    token.type = TokenType::Star;
+                }
+            } else if (c == '?') {
+                token.type = TokenType::AnyChar;
+            } else if (c == '[') {
+                token.type = TokenType::Class;
+                size_t j = i + 1;
+                if (j < pattern.size() && (pattern[j] == '!' || pattern[j] == '^')) {
+                    token.negated = true;
+                    ++j;
+                }
+                // First ']' in class is a literal character, as in shell globs.
+                for (bool first = true; j < pattern.size() && (first || pattern[j] != ']'); ++j, first = false) {
+                    const char first_char = pattern[j];
+                    char last_char = first_char;
+                    if (j + 2 < pattern.size() && pattern[j + 1] == '-' && pattern[j + 2] != ']') {
+                        last_char = pattern[j + 2];
+                        j += 2;
+                    }
+                    token.ranges.push_back(first_char);
+                    token.ranges.push_back(last_char);
+                }
+                if (j >= pattern.size()) {
+                    throw exceptions::RuleSyntaxError();
+                }
+                i = j;
+            } else if (c == '\\' && i + 1 < pattern.size()) {
+                token.literal = pattern[++i];
+            } else {
+                token.literal = c;
+            }
+            tokens.push_back(std::move(token));
+        }
+
+        if (tokens.size() > MAX_TOKENS) {
+            throw exceptions::RuleSyntaxError();
+        }
+        Compile(tokens);
+
+        // Literal prefix and suffix allow to reject most paths without running the automaton.
+        size_t prefix_end = 0;
+        for (; prefix_end < tokens.size() && tokens[prefix_end].type == TokenType::Literal; ++prefix_end) {
+            m_literal_prefix.push_back(tokens[prefix_end].literal);
+        }
+        if (prefix_end != tokens.size()) {
+            for (size_t i = tokens.size(); i > prefix_end && tokens[i - 1].type == TokenType::Literal; --i) {
+                m_literal_suffix.insert(m_literal_suffix.begin(), tokens[i - 1].literal);
+            }
+        } else {
+            m_literal_suffix = m_literal_prefix;
+        }
+    }
+
+    void GlobPattern::Compile(const std::vector<Token> &tokens) {
+        m_accept = uint64_t{1} << tokens.size();
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            const Token &token = tokens[i];
+            const uint64_t state = uint64_t{1} << i;
+            for (size_t c = 0; c < ALPHABET_SIZE; ++c) {
+                const char ch = static_cast<char>(c);
+                bool advances = false;
+                bool loops = false;
+                switch (token.type) {
+                    case TokenType::Literal:
+                        advances = ch == token.literal;
+                        break;
+                    case TokenType::AnyChar:
+                        advances = ch != SEPARATOR;
+                        break;
+                    case TokenType::Class:
+                        advances = ch != SEPARATOR && ClassMatch(token, ch);
+                        break;
+                    case TokenType::Star:
+                        loops = ch != SEPARATOR;
+                        break;
+                    case TokenType::DoubleStar:
+                        loops = true;
+                        break;
+                    case TokenType::DirSeparator:
+                        advances = ch == SEPARATOR;
+                        break;
+                    case TokenType::DirStar:
+                        break;
+                }
+                m_advance[c] |= advances ? state : 0;
+                m_loop[c] |= loops ? state : 0;
+            }
+
+            // Stars may match empty string, so they have epsilon transition to the next state.
+            // DirStar enters "**/" group or bypasses it entirely.
+            if (token.type == TokenType::Star || token.type == TokenType::DoubleStar ||
+                token.type == TokenType::DirStar) {
+                m_epsilon_next |= state;
+            }
+            if (token.type == TokenType::DirStar) {
+                m_epsilon_skip |= state;
+            }
+        }
+    }
+
+    bool GlobPattern::ClassMatch(const Token &token, char c) {
+        bool found = false;
+        for (size_t i = 0; i + 1 < token.ranges.size() && !found; i += 2) {
+            found = token.ranges[i] <= c && c <= token.ranges[i + 1];
+        }
+        return found != token.negated;
+    }
+
+    uint64_t GlobPattern::Closure(uint64_t states) const {
+        // Only runs of adjacent stars need more than one iteration.
+        for (uint64_t previous = 0; previous != states;) {
+            previous = states;
+            states |= (states & m_epsilon_next) << 1 | (states & m_epsilon_skip) << DIR_STAR_GROUP_SIZE;
+        }
+        return states;
+    }
+
+    uint64_t GlobPattern::Step(uint64_t states, char c) const {
+        const auto index = static_cast<unsigned char>(c);
+        return Closure((states & m_advance[index]) << 1 | (states & m_loop[index]));
+    }
+
+    uint64_t GlobPattern::Feed(std::string_view path, bool trailing_separator) const {
+        uint64_t states = Closure(1);
+        for (const char c : path) {
+            states = Step(states, c);
+            if (states == 0) {
+                return 0;
+            }
+        }
+        return trailing_separator ? Step(states, SEPARATOR) : states;
+    }
+
+    bool GlobPattern::Run(std::string_view path, bool trailing_separator) const {
+        if (m_basename_only) {
+            const size_t separator_pos = path.rfind(SEPARATOR);
+            if (separator_pos != std::string_view::npos) {
+                path.remove_prefix(separator_pos + 1);
+            }
+        }
+
+        if (!StartsWith(path, m_literal_prefix) && !(trailing_separator && path.size() < m_literal_prefix.size())) {
+            return false;
+        }
+        if (!trailing_separator && !EndsWith(path, m_literal_suffix)) {
+            return false;
+        }
+
+        return Feed(path, trailing_separator) & m_accept;
+    }
+
+    bool GlobPattern::Match(std::string_view path) const { return Run(path, false); }
+
+    bool GlobPattern::MatchDirectory(std::string_view path) const { return Run(path, false) || Run(path, true); }
+
+    bool GlobPattern::MayMatchBeneath(std::string_view path) const {
+        if (m_basename_only) {
+            return true;
+        }
+        // Live states may still reach the accepting one, so the subtree may contain matching paths.
+        return Feed(path, true) != 0;
+    }
+
+    RuleSet RuleSet::Load(const std::filesystem::path &config) {
+        std::ifstream ifs(config);
+        if (!ifs.is_open()) {
+            throw exceptions::RulesFileError();
+        }
+        return Parse(ifs);
+    }
+
+    RuleSet RuleSet::Parse(std::istream &is) {
+        RuleSet rules;
+        for (std::string line; std::getline(is, line);) {
+            std::istringstream line_stream(line);
+            std::string keyword;
+            std::string pattern;
+            std::string translator;
+            std::string extra;
+            if (!(line_stream >> keyword) || keyword.front() == COMMENT) {
+                continue;
+            }
+            if (!(line_stream >> pattern)) {
+                throw exceptions::RuleSyntaxError();
+            }
+
+            if (keyword == TRANSLATE_KEYWORD) {
+                if (!(line_stream >> translator)) {
+                    throw exceptions::RuleSyntaxError();
+                }
+                rules.Add(RuleAction::Translate, pattern, translator);
+            } else if (keyword == INCLUDE_KEYWORD) {
+                rules.Add(RuleAction::Include, pattern);
+            } else if (keyword == EXCLUDE_KEYWORD) {
+                rules.Add(RuleAction::Exclude, pattern);
+            } else if (keyword == SKIP_KEYWORD) {
+                rules.Add(RuleAction::Skip, pattern);
+            } else {
+                throw exceptions::RuleSyntaxError();
+            }
+
+            if (line_stream >> extra) {
+                throw exceptions::RuleSyntaxError();
+            }
+        }
+        return rules;
+    }
+
+    void RuleSet::Add(RuleAction action, std::string_view pattern, std::string_view translator) {
+        m_has_include = m_has_include || action == RuleAction::Include;
+        m_rules.push_back({action, GlobPattern(pattern), std::string(translator)});
+    }
+
+    bool RuleSet::IsExcluded(std::string_view rel_path, bool is_directory) const {
+        std::optional<RuleAction> decision;
+        size_t decision_index = 0;
+        for (size_t i = 0; i < m_rules.size(); ++i) {
+            const auto &rule = m_rules[i];
+            if (rule.action != RuleAction::Include && rule.action != RuleAction::Exclude) {
+                continue;
+            }
+            bool matched = is_directory ? rule.pattern.MatchDirectory(rel_path) : rule.pattern.Match(rel_path);
+            // Excluded directory excludes everything beneath it, only a later include of the path itself
+            // brings it back.
+            matched = matched || (rule.action == RuleAction::Exclude && MatchesAncestor(rule.pattern, rel_path));
+            if (matched) {
+                decision = rule.action;
+                decision_index = i;
+            }
+        }
+
+        if (decision && *decision == RuleAction::Exclude && is_directory) {
+            // Last matching rule wins for files, so the subtree is kept, if a later include may win beneath.
+            for (size_t i = decision_index + 1; i < m_rules.size(); ++i) {
+                if (m_rules[i].action == RuleAction::Include && m_rules[i].pattern.MayMatchBeneath(rel_path)) {
+                    return false;
+                }
+            }
+        }
+        if (decision) {
+            return *decision == RuleAction::Exclude;
+        }
+        // Include rules select files, directories are traversed unless excluded explicitly.
+        return !is_directory && m_has_include;
+    }
+
+    bool RuleSet::IsSkipped(std::string_view rel_path) const {
+        for (const auto &rule : m_rules) {
+            if (rule.action == RuleAction::Skip && rule.pattern.Match(rel_path)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::optional<std::string_view> RuleSet::TranslatorFor(std::string_view rel_path) const {
+        for (const auto &rule : m_rules) {
+            if (rule.action == RuleAction::Translate && rule.pattern.Match(rel_path)) {
+                return rule.translator;
+            }
+        }
+        return std::nullopt;
+    }
+}  // namespace ffinder
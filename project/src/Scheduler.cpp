@@ -0,0 +1,126 @@
+#include "Scheduler.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <utility>
+
+namespace generator {
+    SizeAwareScheduler::SizeAwareScheduler(const SchedulerConfig &config) : m_config(config) {
+        m_config.io_per_device = std::max<size_t>(m_config.io_per_device, 1);
+    }
+
+    void SizeAwareScheduler::AddCpuJob(uintmax_t size, TaskType task) {
+        m_cpu_jobs.push_back({size, 0, std::move(task)});
+    }
+
+    void SizeAwareScheduler::AddIoJob(uintmax_t size, DeviceIdType device, TaskType task) {
+        m_io_jobs.push_back({size, device, std::move(task)});
+    }
+
+    void SizeAwareScheduler::Run() {
+        constexpr auto LargerFirst = [](const Job &lhs, const Job &rhs) { return lhs.size > rhs.size; };
+        // Stable sort keeps finder order for equal sizes, so runs are reproducible.
+        std::stable_sort(m_cpu_jobs.begin(), m_cpu_jobs.end(), LargerFirst);
+        m_io_jobs.sort(LargerFirst);
+        m_next_cpu_job = 0;
+        m_error = nullptr;
+
+        constexpr auto AddSize = [](uintmax_t total, const Job &job) { return total + job.size; };
+        uintmax_t total_bytes = std::accumulate(m_cpu_jobs.begin(), m_cpu_jobs.end(), uintmax_t{0}, AddSize);
+        total_bytes = std::accumulate(m_io_jobs.begin(), m_io_jobs.end(), total_bytes, AddSize);
+        const bool serial = total_bytes < m_config.serial_bytes;
+
+        // Serially the calling thread runs CPU jobs and then I/O jobs, order of jobs is the same.
+        size_t cpu_workers = 1;
+        size_t io_workers = 0;
+        if (!serial) {
+            // Number of CPUs is read from /sys on Linux, so small runs do not ask for it.
+            cpu_workers = m_config.cpu_workers != 0 ? m_config.cpu_workers : std::thread::hardware_concurrency();
+            cpu_workers = std::clamp<size_t>(cpu_workers, 1, std::max<size_t>(m_cpu_jobs.size(), 1));
+            io_workers = std::min(m_config.io_workers, m_io_jobs.size());
+        }
+
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < io_workers; ++i) {
+            workers.emplace_back(&SizeAwareScheduler::IoWorker, this);
+        }
+        // The calling thread is one of CPU workers.
+        for (size_t i = 1; i < cpu_workers; ++i) {
+            workers.emplace_back(&SizeAwareScheduler::CpuWorker, this);
+        }
+        CpuWorker();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+
+        m_cpu_jobs.clear();
+        m_io_jobs.clear();
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    void SizeAwareScheduler::CpuWorker() {
+        while (true) {
+            Job *job = nullptr;
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_error || m_next_cpu_job == m_cpu_jobs.size()) {
+                    break;
+                }
+                job = &m_cpu_jobs[m_next_cpu_job++];
+            }
+            Execute(*job);
+        }
+        // CPU jobs are drained, the rest of I/O jobs is shared with the dedicated workers.
+        IoWorker();
+    }
+
+    void SizeAwareScheduler::IoWorker() {
+        while (RunNextIoJob()) {
+        }
+    }
+
+    bool SizeAwareScheduler::RunNextIoJob() {
+        std::unique_lock lock(m_mutex);
+        auto job_it = m_io_jobs.end();
+        m_io_released.wait(lock, [this, &job_it] {
+            if (m_error || m_io_jobs.empty()) {
+                return true;
+            }
+            // Largest pending job, whose device is not saturated.
+            job_it = std::find_if(m_io_jobs.begin(), m_io_jobs.end(), [this](const Job &job) {
+                return m_io_in_flight[job.device] < m_config.io_per_device;
+            });
+            return job_it != m_io_jobs.end();
+        });
+        if (m_error || m_io_jobs.empty()) {
+            return false;
+        }
+
+        Job job = std::move(*job_it);
+        m_io_jobs.erase(job_it);
+        ++m_io_in_flight[job.device];
+        lock.unlock();
+
+        Execute(job);
+
+        lock.lock();
+        --m_io_in_flight[job.device];
+        m_io_released.notify_all();
+        return true;
+    }
+
+    void SizeAwareScheduler::Execute(Job &job) {
+        try {
+            job.task();
+        } catch (...) {
+            std::lock_guard lock(m_mutex);
+            if (!m_error) {
+                m_error = std::current_exception();
+            }
+            m_io_released.notify_all();
+        }
+    }
+}  // namespace generator
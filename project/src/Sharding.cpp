@@ -0,0 +1,96 @@
+#include "Sharding.hpp"
+
+#include <charconv>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace generator {
+    namespace {
+        constexpr char SHARD_SEPARATOR = '/';
+
+        size_t ParseNumber(std::string_view number) {
+            size_t result = 0;
+            const auto [ptr, ec] = std::from_chars(number.data(), number.data() + number.size(), result);
+            if (number.empty() || ec != std::errc() || ptr != number.data() + number.size()) {
+                throw exceptions::InvalidShardSpecError();
+            }
+            return result;
+        }
+    }  // namespace
+
+    ShardSpec ShardSpec::Parse(std::string_view spec) {
+        const size_t separator_pos = spec.find(SHARD_SEPARATOR);
+        if (separator_pos == std::string_view::npos) {
+            throw exceptions::InvalidShardSpecError();
+        }
+
+        ShardSpec result;
+        result.index = ParseNumber(spec.substr(0, separator_pos));
+        result.count = ParseNumber(spec.substr(separator_pos + 1));
+        if (result.count == 0 || result.index >= result.count) {
+            throw exceptions::InvalidShardSpecError();
+        }
+        return result;
+    }
+
+    uint64_t ShardPartitioner::Hash(std::string_view data) {
+        constexpr uint64_t fnv_offset = 14695981039346656037ULL;
+        constexpr uint64_t fnv_prime = 1099511628211ULL;
+        uint64_t hash = fnv_offset;
+        for (const char c : data) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= fnv_prime;
+        }
+        return hash;
+    }
+
+    size_t ShardPartitioner::ShardOf(const ffinder::PathType &rel_path) const {
+        if (m_spec.IsSingle()) {
+            return 0;
+        }
+        // Directory affinity: the shard is chosen by the parent directory, so files of one
+        // directory are generated by one process. generic_string() keeps hash host independent.
+        return Hash(rel_path.parent_path().generic_string()) % m_spec.count;
+    }
+
+    ffinder::PathType ShardManifestPath(const ffinder::PathType &output_dir, const ShardSpec &spec) {
+        return output_dir / (std::string(MANIFEST_NAME) + "." + std::to_string(spec.index) + "-of-" +
+                             std::to_string(spec.count));
+    }
+
+    void MergeShardManifests(const ffinder::PathType &output_dir, size_t shards_count,
+                             const ffinder::BasicFileSystem::FileSystemShPtr &file_system) {
+        if (shards_count == 0) {
+            throw exceptions::InvalidShardSpecError();
+        }
+
+        // std::set makes merged manifest independent of shards finishing order.
+        std::set<std::string> generated_files;
+        for (size_t index = 0; index < shards_count; ++index) {
+            auto is = file_system->OpenRead(ShardManifestPath(output_dir, {index, shards_count}));
+            if (!is) {
+                throw exceptions::ShardManifestError();
+            }
+            for (std::string line; std::getline(*is, line);) {
+                if (!line.empty()) {
+                    generated_files.emplace(std::move(line));
+                }
+            }
+        }
+
+        {
+            auto os = file_system->OpenWrite(output_dir / MANIFEST_NAME);
+            if (!os) {
+                throw exceptions::ShardManifestError();
+            }
+            for (const auto &file : generated_files) {
+                *os << file << '\n';
+            }
+        }
+
+        for (size_t index = 0; index < shards_count; ++index) {
+            file_system->RemoveFile(ShardManifestPath(output_dir, {index, shards_count}));
+        }
+    }
+}  // namespace generator
@@ -1,12 +1,13 @@
 #include "Translator.hpp"
 
 #include <algorithm>
-#include <iostream>
 #include <iterator>
 #include <sstream>
 #include <string>
 #include <tuple>
 
+#include "HtmlEscape.hpp"
+
 namespace generator {
     namespace {
         constexpr char WS = 32;
@@ -27,6 +28,16 @@ namespace generator {
             // clang-format on
             return {line.begin() + i, line.end()};
         }
+
+        // Wraps escaped content into tags without intermediate copies of the content.
+        std::string WrapEscaped(std::string_view open, std::string_view content, std::string_view close) {
+            std::string result;
+            result.reserve(open.size() + content.size() + close.size());
+            result.append(open);
+            AppendEscaped(result, content);
+            result.append(close);
+            return result;
+        }
     }  // namespace
 
     void DefaultTranslator::Translate(IStreamType &is, OStreamType &os) {
@@ -79,7 +90,11 @@ namespace generator {
         }
 
         if (preformed_state) {
-            return line;
+            // Most preformatted lines are clean, so copy is done only when escaping is really needed.
+            if (FindEscapable(line, 0, EscapeContext::Text) == std::string_view::npos) {
+                return line;
+            }
+            return WrapEscaped({}, line, {});
         }
 
         if (LineStartWith(line, LINK_PREFIX)) {
@@ -106,7 +121,7 @@ namespace generator {
     }
 
     GemToHTMLTranslator::LineType GemToHTMLTranslator::ParagraphTranslator(const LineType &line) const {
-        return paragraph_open.data() + line + paragraph_close.data();
+        return WrapEscaped(paragraph_open, line, paragraph_close);
     }
 
     GemToHTMLTranslator::LineType GemToHTMLTranslator::BlockquoteTranslator(const LineType &line) const {
@@ -117,7 +132,7 @@ namespace generator {
             throw exceptions::BlockquoteFormatError();
         }
 
-        return blockquote_open + paragraph_open.data() + content + paragraph_close.data() + blockquote_close;
+        return blockquote_open + WrapEscaped(paragraph_open, content, paragraph_close) + blockquote_close;
     }
 
     GemToHTMLTranslator::LineType GemToHTMLTranslator::HeaderTranslator(const LineType &line) const {
@@ -132,7 +147,8 @@ namespace generator {
             // size of prefix in gemtext
             if (LineStartWith(line, h3)) return {"<h3>", "</h3>", 3};
             if (LineStartWith(line, h2)) return {"<h2>", "</h2>", 2};
-            if (LineStartWith(line, h1)) return {"<h1>", "</h1>", 1};
+            // Line is dispatched here only when it starts with h1 prefix.
+            return {"<h1>", "</h1>", h1.size()};
         }();
 
         LineType content = SkipLeadingWs({line.begin() + prefix_size, line.end()});
@@ -140,12 +156,18 @@ namespace generator {
             throw exceptions::HeaderFormatError();
         }
 
-        return header_open + content + header_close;
+        return WrapEscaped(header_open, content, header_close);
     }
 
     GemToHTMLTranslator::LineType GemToHTMLTranslator::LinkTranslator(const LineType &line) const {
         constexpr auto RefFormatter = [](const LineType &ref, const LineType &content) {
-            return "<a href=\"" + ref + "\">" + content + "</a>";
+            // Reference is placed into quoted attribute, so it is escaped in attribute context.
+            LineType result = "<a href=\"";
+            AppendEscaped(result, ref, EscapeContext::Attribute);
+            result.append("\">");
+            AppendEscaped(result, content);
+            result.append("</a>");
+            return result;
         };
 
         LineType content = SkipLeadingWs({line.begin() + LINK_PREFIX.size(), line.end()});
@@ -161,8 +183,12 @@ namespace generator {
 
         LineType reference = {content.begin(), content.begin() + ref_size};
         LineType link_text = SkipLeadingWs({content.begin() + ref_size, content.end()});
+        if (link_text.empty()) {
+            // Only trailing spaces follow the reference.
+            return RefFormatter(reference, reference);
+        }
 
-        return RefFormatter(reference, content);
+        return RefFormatter(reference, link_text);
     }
 
     GemToHTMLTranslator::LineType GemToHTMLTranslator::ListTranslator(const LineType &line) const {
@@ -173,7 +199,7 @@ namespace generator {
             throw exceptions::ListFormatError();
         }
 
-        return list_open + content + list_close;
+        return WrapEscaped(list_open, content, list_close);
     }
 
     void GemToHTMLTranslator::WriteHeader(OStreamType &os) const {
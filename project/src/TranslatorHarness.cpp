@@ -0,0 +1,312 @@
+#include "TranslatorHarness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <typeinfo>
+
+#include "FSEntryFinder.hpp"
+#include "FileSystem.hpp"
+#include "Generator.hpp"
+#include "HtmlEscape.hpp"
+#include "Translator.hpp"
+
+namespace generator {
+    namespace {
+        constexpr std::string_view HTML_HEADER =
+            "<!DOCTYPE html>\n"
+            "<html lang=\"en\">\n"
+            "<head>\n"
+            "\t<meta charset=\"UTF-8\">\n"
+            "\t<title>Title</title>\n"
+            "</head>\n"
+            "<body>\n";
+        constexpr std::string_view HTML_FOOTER =
+            "</body>\n"
+            "</html>";
+        constexpr size_t MAX_HEADER_LEVEL = 3;
+        constexpr size_t TIMING_REPEATS = 5;
+
+        bool StartsWith(std::string_view line, std::string_view prefix) { return line.substr(0, prefix.size()) == prefix; }
+
+        std::string_view SkipSpaces(std::string_view line) {
+            return line.substr(std::min(line.find_first_not_of(' '), line.size()));
+        }
+
+        std::string Escape(std::string_view text, EscapeContext context = EscapeContext::Text) {
+            std::string result;
+            AppendEscapedScalar(result, text, context);
+            return result;
+        }
+
+        std::string ReferenceLine(std::string_view line, bool &preformatted) {
+            if (StartsWith(line, "```")) {
+                preformatted = !preformatted;
+                return {};
+            }
+            if (preformatted) {
+                return Escape(line);
+            }
+
+            if (StartsWith(line, "=>")) {
+                const std::string_view content = SkipSpaces(line.substr(2));
+                if (content.empty()) {
+                    throw exceptions::LinkFormatError();
+                }
+                const size_t space = content.find(' ');
+                const std::string_view reference = content.substr(0, space);
+                std::string_view text = space == std::string_view::npos ? "" : SkipSpaces(content.substr(space));
+                if (text.empty()) {
+                    text = reference;
+                }
+                return "<a href=\"" + Escape(reference, EscapeContext::Attribute) + "\">" + Escape(text) + "</a>";
+            }
+
+            if (StartsWith(line, "#")) {
+                size_t level = 0;
+                while (level < MAX_HEADER_LEVEL && level < line.size() && line[level] == '#') {
+                    ++level;
+                }
+                const std::string_view content = SkipSpaces(line.substr(level));
+                if (content.empty()) {
+                    throw exceptions::HeaderFormatError();
+                }
+                const std::string tag = "h" + std::to_string(level) + ">";
+                return "<" + tag + Escape(content) + "</" + tag;
+            }
+
+            if (StartsWith(line, "*")) {
+                const std::string_view content = SkipSpaces(line.substr(1));
+                if (content.empty()) {
+                    throw exceptions::ListFormatError();
+                }
+                return "<li>" + Escape(content) + "</li>";
+            }
+
+            if (StartsWith(line, ">")) {
+                const std::string_view content = SkipSpaces(line.substr(1));
+                if (content.empty()) {
+                    throw exceptions::BlockquoteFormatError();
+                }
+                return "<blockquote><p>" + Escape(content) + "</p></blockquote>";
+            }
+
+            if (line.empty()) {
+                return "<br/>";
+            }
+            return "<p>" + Escape(line) + "</p>";
+        }
+
+        /**
+         * Stream buffer, that gives input away in chunks of 1 to 13 characters, so lines
+         * are split between reads at every possible position.
+         */
+        class ChunkedStreamBuf : public std::streambuf {
+         public:
+            explicit ChunkedStreamBuf(std::string_view data) : m_data(data) {}
+
+         protected:
+            int_type underflow() override {
+                if (m_pos >= m_data.size()) {
+                    return traits_type::eof();
+                }
+                constexpr size_t MAX_CHUNK = 13;
+                const size_t chunk = std::min(1 + (m_reads++ * 7) % MAX_CHUNK, m_data.size() - m_pos);
+                char *begin = const_cast<char *>(m_data.data()) + m_pos;
+                setg(begin, begin, begin + chunk);
+                m_pos += chunk;
+                return traits_type::to_int_type(*begin);
+            }
+
+         private:
+            std::string_view m_data;
+            size_t m_pos = 0;
+            size_t m_reads = 0;
+        };
+
+        struct Outcome {
+            std::string html;
+            // Name of the exception type, empty if translation succeeded.
+            std::string error;
+
+            bool operator==(const Outcome &other) const {
+                return error == other.error && (!error.empty() || html == other.html);
+            }
+        };
+
+        template <typename Translation>
+        Outcome Run(Translation translation) {
+            Outcome outcome;
+            try {
+                outcome.html = translation();
+            } catch (const std::exception &ex) {
+                outcome.error = typeid(ex).name();
+            }
+            return outcome;
+        }
+
+        std::string TranslateStream(std::istream &is) {
+            std::ostringstream os;
+            GemToHTMLTranslator translator;
+            translator.Translate(is, os);
+            return std::move(os).str();
+        }
+
+        std::string Describe(const std::string &path, const Outcome &expected, const Outcome &actual) {
+            std::ostringstream description;
+            description << path << " differs from the reference: ";
+            if (expected.error != actual.error) {
+                description << "expected error '" << expected.error << "', got '" << actual.error << "'";
+            } else {
+                const auto diff = std::mismatch(expected.html.begin(), expected.html.end(), actual.html.begin(),
+                                                actual.html.end());
+                description << "html differs at offset " << diff.first - expected.html.begin();
+            }
+            return description.str();
+        }
+
+        /**
+         * Generator failed, but left the output page behind.
+         */
+        class PartialOutputError : public std::exception {
+         public:
+            const char *what() const noexcept override { return "Failed page left partial output."; }
+        };
+
+        /**
+         * Generates the site of the single page in memory.
+         * @param small_files Whether the page takes the fast path of the generator or file streams.
+         */
+        std::string GeneratePage(std::string_view input, const SmallFileConfig &small_files) {
+            auto file_system = std::make_shared<ffinder::MemoryFileSystem>();
+            file_system->AddFile("input/page.gmi", input);
+            file_system->AddDirectory("output");
+            GemtextGenerator gemtext_generator(ffinder::CreateFinder<ffinder::RRegularFileFinder>(file_system));
+            gemtext_generator.SetFileSystem(file_system);
+            gemtext_generator.SetSmallFiles(small_files);
+            // The page is generated by the calling thread whatever its size.
+            SchedulerConfig scheduling;
+            scheduling.serial_bytes = std::numeric_limits<uintmax_t>::max();
+            gemtext_generator.SetScheduling(scheduling);
+            try {
+                gemtext_generator.Generate("input", "output");
+            } catch (...) {
+                if (file_system->Exists("output/page.html")) {
+                    throw PartialOutputError();
+                }
+                throw;
+            }
+            return std::string(*file_system->ReadFile("output/page.html"));
+        }
+
+        std::chrono::nanoseconds BestTranslationTime(const std::string &input) {
+            auto best = std::chrono::nanoseconds::max();
+            for (size_t i = 0; i < TIMING_REPEATS; ++i) {
+                std::istringstream is(input);
+                const auto start = std::chrono::steady_clock::now();
+                Run([&is] { return TranslateStream(is); });
+                best = std::min(best, std::chrono::steady_clock::now() - start);
+            }
+            return std::max(best, std::chrono::nanoseconds(1));
+        }
+    }  // namespace
+
+    std::string ReferenceGemToHTML(std::string_view input) {
+        std::string html(HTML_HEADER);
+        bool preformatted = false;
+        bool list = false;
+        for (size_t begin = 0; begin <= input.size();) {
+            const size_t end = std::min(input.find('\n', begin), input.size());
+            const std::string_view line = input.substr(begin, end - begin);
+            const std::string translated = ReferenceLine(line, preformatted);
+            if (StartsWith(line, "*") != list) {
+                list = !list;
+                html.append(list ? "<ul>\n" : "</ul>\n");
+            }
+            html.append(translated).push_back('\n');
+            begin = end + 1;
+        }
+        if (list) {
+            html.append("</ul>\n");
+        }
+        if (preformatted) {
+            throw exceptions::PreformedFormatError();
+        }
+        return html.append(HTML_FOOTER);
+    }
+
+    DifferentialReport CheckTranslation(std::string_view input) {
+        DifferentialReport report;
+        const Outcome expected = Run([input] { return ReferenceGemToHTML(input); });
+
+        const Outcome streamed = Run([input] {
+            std::istringstream is{std::string(input)};
+            return TranslateStream(is);
+        });
+
+        const Outcome chunked = Run([input] {
+            ChunkedStreamBuf buf(input);
+            std::istream is(&buf);
+            return TranslateStream(is);
+        });
+
+        if (!(streamed == expected)) {
+            report.consistent = false;
+            report.mismatch = Describe("String stream translation", expected, streamed);
+            return report;
+        }
+        if (!(chunked == expected)) {
+            report.consistent = false;
+            report.mismatch = Describe("Chunked stream translation", expected, chunked);
+            return report;
+        }
+
+        const Outcome fast_path = Run([input] { return GeneratePage(input, {input.size() + 1, false}); });
+        if (!(fast_path == expected)) {
+            report.consistent = false;
+            report.mismatch = Describe("Generated small page", expected, fast_path);
+            return report;
+        }
+        const Outcome streamed_page = Run([input] { return GeneratePage(input, {0, false}); });
+        if (!(streamed_page == expected)) {
+            report.consistent = false;
+            report.mismatch = Describe("Generated streamed page", expected, streamed_page);
+            return report;
+        }
+
+        for (size_t begin = 0; begin <= input.size();) {
+            const size_t end = std::min(input.find('\n', begin), input.size());
+            const std::string_view line = input.substr(begin, end - begin);
+            for (auto context : {EscapeContext::Text, EscapeContext::Attribute}) {
+                std::string vectorized;
+                AppendEscaped(vectorized, line, context);
+                if (vectorized != Escape(line, context)) {
+                    report.consistent = false;
+                    report.mismatch = "Vectorized escaping differs from the scalar one at line offset " +
+                                      std::to_string(begin);
+                    return report;
+                }
+            }
+            begin = end + 1;
+        }
+        return report;
+    }
+
+    double TranslationScaling(std::string_view input, size_t factor) {
+        const std::string original(input);
+        std::string repeated = original;
+        for (size_t i = 1; i < factor; ++i) {
+            repeated.append("\n").append(original);
+        }
+        // Untimed run warms up code and allocator, so the first measurement is not inflated.
+        BestTranslationTime(repeated);
+        const auto small = BestTranslationTime(original);
+        const auto large = BestTranslationTime(repeated);
+        return static_cast<double>(large.count()) / (static_cast<double>(small.count()) * std::max<size_t>(factor, 1));
+    }
+}  // namespace generator
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FileSystem.hpp"
+#include "TempDirectory.hpp"
+
+using WalkAction = ffinder::BasicFileSystem::WalkAction;
+
+class MemoryFileSystemTests : public ::testing::Test {
+ protected:
+    ffinder::MemoryFileSystem file_system;
+
+    void SetUp() {
+        file_system.AddFile("root/file1", "content1");
+        file_system.AddFile("root/dir/file2", "content2");
+        file_system.AddFile("root/dir-2/file3", "");
+        file_system.AddDirectory("root/empty");
+    }
+
+    std::vector<std::string> Walk(bool recursive, const std::string &pruned = {}) {
+        std::vector<std::string> visited;
+        file_system.Walk("root", recursive, [&visited, &pruned](const auto &entry) {
+            visited.emplace_back(entry.relative);
+            return entry.relative == pruned ? WalkAction::SkipSubtree : WalkAction::Continue;
+        });
+        return visited;
+    }
+};
+
+TEST_F(MemoryFileSystemTests, ParentDirectoriesCreated) {
+    ASSERT_TRUE(file_system.IsDirectory("root"));
+    ASSERT_TRUE(file_system.IsDirectory("root/dir/"));
+    ASSERT_FALSE(file_system.IsDirectory("root/file1"));
+    ASSERT_TRUE(file_system.Exists("./root/dir/../file1"));
+    ASSERT_FALSE(file_system.Exists("root/file2"));
+}
+
+TEST_F(MemoryFileSystemTests, WalkRecursive) {
+    ASSERT_EQ(Walk(true), (std::vector<std::string>{"dir", "dir/file2", "dir-2", "dir-2/file3", "empty", "file1"}));
+}
+
+TEST_F(MemoryFileSystemTests, WalkNotRecursive) {
+    ASSERT_EQ(Walk(false), (std::vector<std::string>{"dir", "dir-2", "empty", "file1"}));
+}
+
+TEST_F(MemoryFileSystemTests, WalkSkipSubtree) {
+    ASSERT_EQ(Walk(true, "dir"), (std::vector<std::string>{"dir", "dir-2", "dir-2/file3", "empty", "file1"}));
+    ASSERT_EQ(Walk(true, "dir-2"), (std::vector<std::string>{"dir", "dir/file2", "dir-2", "empty", "file1"}));
+}
+
+TEST_F(MemoryFileSystemTests, StreamsReadAndWrite) {
+    {
+        auto os = file_system.OpenWrite("root/dir/new");
+        ASSERT_TRUE(os);
+        *os << "written";
+    }
+    ASSERT_EQ(file_system.ReadFile("root/dir/new"), "written");
+
+    auto is = file_system.OpenRead("root/file1");
+    ASSERT_TRUE(is);
+    std::string content{std::istreambuf_iterator<char>(*is), std::istreambuf_iterator<char>()};
+    ASSERT_EQ(content, "content1");
+
+    ASSERT_FALSE(file_system.OpenRead("root/dir"));
+    ASSERT_FALSE(file_system.OpenWrite("root/missing/file"));
+}
+
+TEST_F(MemoryFileSystemTests, CopyTreeAndFiles) {
+    file_system.CopyDirectoryTree("root", "out");
+    ASSERT_TRUE(file_system.IsDirectory("out/dir"));
+    ASSERT_TRUE(file_system.IsDirectory("out/empty"));
+    ASSERT_FALSE(file_system.Exists("out/file1"));
+
+    file_system.CopyFile("root/file1", "out/file1");
+    ASSERT_EQ(file_system.ReadFile("out/file1"), "content1");
+    ASSERT_THROW(file_system.CopyFile("root/file1", "missing/file1"), std::filesystem::filesystem_error);
+}
+
+TEST(MemoryFileSystemEmptyTests, EmptyFirstFile) {
+    ffinder::MemoryFileSystem file_system;
+    file_system.AddFile("empty", "");
+    ASSERT_EQ(file_system.ReadFile("empty"), "");
+}
+
+TEST_F(MemoryFileSystemTests, LargeFiles) {
+    const std::string large(3 << 20, 'x');
+    file_system.AddFile("large", large);
+    file_system.AddFile("small", "small");
+    ASSERT_EQ(file_system.ReadFile("large"), large);
+    ASSERT_EQ(file_system.ReadFile("small"), "small");
+    ASSERT_EQ(file_system.ReadFile("root/file1"), "content1");
+}
+
+TEST_F(MemoryFileSystemTests, VisitorUsesFileSystem) {
+    std::vector<std::string> contents;
+    file_system.Walk("root", true, [this, &contents](const auto &entry) {
+        if (!entry.is_directory) {
+            contents.emplace_back(*file_system.ReadFile(ffinder::PathType("root") / entry.relative));
+        }
+        return WalkAction::Continue;
+    });
+    ASSERT_EQ(contents, std::vector<std::string>({"content2", "", "content1"}));
+}
+
+TEST_F(MemoryFileSystemTests, RemoveFile) {
+    ASSERT_TRUE(file_system.RemoveFile("root/file1"));
+    ASSERT_FALSE(file_system.Exists("root/file1"));
+    ASSERT_FALSE(file_system.RemoveFile("root/file1"));
+    ASSERT_FALSE(file_system.RemoveFile("root/dir"));
+}
+
+TEST_F(MemoryFileSystemTests, ReadAndWriteAll) {
+    std::string content = "stale";
+    ASSERT_TRUE(file_system.ReadAll("root/file1", 0, content));
+    ASSERT_EQ(content, "content1");
+    ASSERT_FALSE(file_system.ReadAll("root/missing", 0, content));
+
+    ASSERT_TRUE(file_system.WriteAll("root/dir/written", "written", true));
+    file_system.FlushDeferred();
+    ASSERT_EQ(file_system.ReadFile("root/dir/written"), "written");
+    ASSERT_FALSE(file_system.WriteAll("root/missing/written", "written"));
+}
+
+class NativeFileSystemTests : public ::testing::Test {
+ protected:
+    std::filesystem::path root;
+    ffinder::NativeFileSystem file_system;
+
+    void SetUp() {
+        root = UniqueTempDirectory();
+    }
+
+    void TearDown() { std::filesystem::remove_all(root); }
+};
+
+TEST_F(NativeFileSystemTests, ReadAllWithAnySizeHint) {
+    const std::string expected(10000, 'x');
+    ASSERT_TRUE(file_system.WriteAll(root / "file", expected));
+    for (uintmax_t hint : {0, 1, 9999, 10000, 20000}) {
+        std::string content;
+        ASSERT_TRUE(file_system.ReadAll(root / "file", hint, content));
+        ASSERT_EQ(content, expected) << "Size hint " << hint;
+    }
+    std::string content;
+    ASSERT_FALSE(file_system.ReadAll(root / "missing", 0, content));
+}
+
+TEST_F(NativeFileSystemTests, DeferredWritesAreComplete) {
+    constexpr size_t files = ffinder::NativeFileSystem::CLOSE_BATCH * 2 + 3;
+    for (size_t i = 0; i < files; ++i) {
+        ASSERT_TRUE(file_system.WriteAll(root / std::to_string(i), std::to_string(i), true));
+    }
+    file_system.FlushDeferred();
+    for (size_t i = 0; i < files; ++i) {
+        std::string content;
+        ASSERT_TRUE(file_system.ReadAll(root / std::to_string(i), 0, content));
+        ASSERT_EQ(content, std::to_string(i));
+    }
+    ASSERT_TRUE(file_system.WriteAll(root / "0", "truncated"));
+    std::string content;
+    ASSERT_TRUE(file_system.ReadAll(root / "0", 0, content));
+    ASSERT_EQ(content, "truncated");
+    ASSERT_FALSE(file_system.WriteAll(root / "missing" / "file", "content"));
+}
+
+TEST_F(NativeFileSystemTests, DirectoryRelativeAccess) {
+    std::filesystem::create_directories(root / "dir");
+    const auto relative = std::filesystem::relative(root / "dir");
+    for (const auto &path : {root / "dir", relative, relative / ""}) {
+        const auto directory = file_system.OpenDirectory(path);
+        ASSERT_EQ(directory->Path(), path);
+        ASSERT_TRUE(file_system.WriteAllAt(*directory, "file", "content"));
+        std::string content;
+        ASSERT_TRUE(file_system.ReadAllAt(*directory, "file", 0, content));
+        ASSERT_EQ(content, "content");
+        ASSERT_FALSE(file_system.ReadAllAt(*directory, "missing", 0, content));
+    }
+    // Missing directory is not an error until its files are accessed.
+    const auto missing = file_system.OpenDirectory(root / "missing");
+    ASSERT_FALSE(file_system.WriteAllAt(*missing, "file", "content"));
+}
+
+TEST_F(NativeFileSystemTests, WalkAndCopyTree) {
+    std::filesystem::create_directories(root / "from" / "dir" / "nested");
+    std::filesystem::create_directories(root / "from" / "pruned" / "nested");
+    ASSERT_TRUE(file_system.WriteAll(root / "from" / "dir" / "file", "12345"));
+    std::filesystem::create_directory_symlink(root / "from" / "dir", root / "from" / "link");
+
+    std::map<std::string, uintmax_t> visited;
+    file_system.Walk(std::filesystem::relative(root / "from"), true, [&visited](const auto &entry) {
+        visited.emplace(entry.relative, entry.is_directory ? -1 : entry.size);
+        return entry.relative == "pruned" ? WalkAction::SkipSubtree : WalkAction::Continue;
+    });
+    const std::map<std::string, uintmax_t> expected = {
+        {"dir", -1}, {"dir/nested", -1}, {"dir/file", 5}, {"pruned", -1}};
+    ASSERT_EQ(visited, expected);
+
+    file_system.CopyDirectoryTree(root / "from", root / "to");
+    file_system.CopyDirectoryTree(root / "from", root / "to");
+    ASSERT_TRUE(std::filesystem::is_directory(root / "to" / "dir" / "nested"));
+    ASSERT_TRUE(std::filesystem::is_directory(root / "to" / "pruned" / "nested"));
+    ASSERT_FALSE(std::filesystem::exists(root / "to" / "dir" / "file"));
+    ASSERT_FALSE(std::filesystem::exists(root / "to" / "link"));
+}
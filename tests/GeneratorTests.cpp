@@ -1,10 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
 #include <string_view>
 
+#include <FileSystem.hpp>
 #include <FSEntryFinder.hpp>
 #include <Generator.hpp>
 
+#include "TempDirectory.hpp"
+
 class GemtextGeneratorTests : public ::testing::Test {
  protected:
     ffinder::BasicFSFinder<ffinder::fs::recursive_directory_iterator>::FSFinderShPtr finder;
@@ -40,3 +49,120 @@ TEST_F(GemtextGeneratorTests, InvalidInput) {
 TEST_F(GemtextGeneratorTests, InvalidOutput) {
     ASSERT_THROW(gemtext_generator.Generate(input, "output"), generator::exceptions::DirNotExistError);
 }
+
+class MemoryGeneratorTests : public ::testing::Test {
+ protected:
+    std::shared_ptr<ffinder::MemoryFileSystem> file_system = std::make_shared<ffinder::MemoryFileSystem>();
+    generator::GemtextGenerator gemtext_generator;
+
+    void SetUp() {
+        gemtext_generator.ResetFinder(ffinder::CreateFinder<ffinder::RRegularFileFinder>(file_system));
+        gemtext_generator.SetFileSystem(file_system);
+        file_system->AddDirectory("output");
+    }
+};
+
+TEST_F(MemoryGeneratorTests, GenerateInMemory) {
+    file_system->AddFile("input/page.gmi", "# Title");
+    file_system->AddFile("input/sub/asset.bin", "binary");
+    file_system->AddDirectory("input/empty");
+    gemtext_generator.Generate("input", "output");
+
+    auto page = file_system->ReadFile("output/page.html");
+    ASSERT_TRUE(page);
+    ASSERT_NE(page->find("<h1>Title</h1>"), std::string_view::npos);
+    ASSERT_EQ(file_system->ReadFile("output/sub/asset.bin"), "binary");
+    ASSERT_TRUE(file_system->IsDirectory("output/empty"));
+    ASSERT_FALSE(std::filesystem::exists("output"));
+}
+
+TEST_F(MemoryGeneratorTests, GenerateSyntheticTree) {
+    constexpr size_t dirs = 50;
+    constexpr size_t files_per_dir = 40;
+    for (size_t dir = 0; dir < dirs; ++dir) {
+        for (size_t file = 0; file < files_per_dir; ++file) {
+            const std::string name = "input/d" + std::to_string(dir) + "/f" + std::to_string(file);
+            file_system->AddFile(name + ".gmi", "text " + std::to_string(file));
+        }
+    }
+    gemtext_generator.Generate("input", "output");
+
+    ffinder::RRegularFileFinder finder(file_system);
+    ASSERT_EQ(finder.CreateFilesList("output").size(), dirs * files_per_dir);
+    ASSERT_NE(file_system->ReadFile("output/d7/f3.html")->find("<p>text 3</p>"), std::string_view::npos);
+}
+
+class SmallFileGeneratorTests : public ::testing::Test {
+ protected:
+    std::filesystem::path root;
+
+    void SetUp() {
+        root = UniqueTempDirectory();
+        std::filesystem::create_directories(root / "input" / "sub");
+        Write("input/page.gmi", "# Title\n* a < b\n* c & d\n=> /x?a=\"1\" Link\n```\n<pre>\n```\n");
+        Write("input/empty.gmi", "");
+        Write("input/sub/large.gmi", std::string(1000, 'x') + "\n> quote\n");
+        Write("input/sub/asset.css", "p {}");
+    }
+
+    void TearDown() { std::filesystem::remove_all(root); }
+
+    void Write(const std::string &path, const std::string &content) { std::ofstream(root / path) << content; }
+
+    /**
+     * @param input Input directory as passed to the generator, root / "input" if empty.
+     */
+    std::map<std::string, std::string> Generate(const std::string &output, const generator::SmallFileConfig &config,
+                                                const std::filesystem::path &input = {}) {
+        std::filesystem::create_directories(root / output);
+        generator::GemtextGenerator gemtext_generator(ffinder::CreateFinder<ffinder::RRegularFileFinder>());
+        gemtext_generator.SetSmallFiles(config);
+        gemtext_generator.Generate(input.empty() ? root / "input" : input, root / output);
+
+        std::map<std::string, std::string> files;
+        for (const auto &entry : std::filesystem::recursive_directory_iterator(root / output)) {
+            if (entry.is_regular_file()) {
+                std::ifstream is(entry.path());
+                files[std::filesystem::relative(entry.path(), root / output).generic_string()] = {
+                    std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+            }
+        }
+        return files;
+    }
+};
+
+TEST_F(SmallFileGeneratorTests, FastPathMatchesStreams) {
+    const auto streamed = Generate("streamed", {0, false});
+    ASSERT_EQ(streamed.size(), 4);
+    ASSERT_NE(streamed.at("page.html").find("<li>a &lt; b</li>"), std::string::npos);
+
+    ASSERT_EQ(Generate("fast", {}), streamed);
+    ASSERT_EQ(Generate("deferred", {1 << 20, true}), streamed);
+    // Only pages below the threshold take the fast path.
+    ASSERT_EQ(Generate("mixed", {500, true}), streamed);
+}
+
+TEST_F(SmallFileGeneratorTests, RelativeInputDirectory) {
+    const auto streamed = Generate("streamed", {0, false});
+    // Working directory is restored even if an assertion fails.
+    struct WorkingDirectory {
+        std::filesystem::path saved = std::filesystem::current_path();
+        ~WorkingDirectory() { std::filesystem::current_path(saved); }
+    } working_directory;
+
+    std::filesystem::current_path(root);
+    ASSERT_EQ(Generate("fast", {}, "input"), streamed);
+    ASSERT_EQ(Generate("trailing", {}, "input/"), streamed);
+    std::filesystem::current_path(root / "input");
+    ASSERT_EQ(Generate("current", {}, "."), streamed);
+}
+
+TEST_F(SmallFileGeneratorTests, FailedPageLeavesNoOutput) {
+    // Header is invalid after some output is already translated.
+    Write("input/broken.gmi", "text\n> quote\n#\n");
+    for (const auto &config : {generator::SmallFileConfig{0, false}, generator::SmallFileConfig{}}) {
+        std::filesystem::remove_all(root / "output");
+        ASSERT_ANY_THROW(Generate("output", config));
+        ASSERT_FALSE(std::filesystem::exists(root / "output" / "broken.html")) << "Small files " << config.max_size;
+    }
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "HtmlEscape.hpp"
+
+using EscapeContext = generator::EscapeContext;
+
+class HtmlEscapeTests : public ::testing::Test {
+ protected:
+    static std::string Escape(const std::string &data, EscapeContext context = EscapeContext::Text) {
+        std::string result;
+        generator::AppendEscaped(result, data, context);
+        return result;
+    }
+};
+
+TEST_F(HtmlEscapeTests, CleanTextUnchanged) {
+    const std::string clean = "Plain text without any markup characters, long enough for vector scan.";
+    ASSERT_EQ(Escape(clean), clean);
+    ASSERT_EQ(generator::FindEscapable(clean, 0, EscapeContext::Text), std::string::npos);
+}
+
+TEST_F(HtmlEscapeTests, TextContext) {
+    ASSERT_EQ(Escape("a < b && c > \"d\" 'e'"), "a &lt; b &amp;&amp; c &gt; \"d\" 'e'");
+}
+
+TEST_F(HtmlEscapeTests, AttributeContext) {
+    ASSERT_EQ(Escape("/q?a=1&b=\"x\"'", EscapeContext::Attribute), "/q?a=1&amp;b=&quot;x&quot;&#39;");
+}
+
+TEST_F(HtmlEscapeTests, CharactersAtChunkBoundaries) {
+    for (size_t pos = 0; pos < 40; ++pos) {
+        std::string data(40, 'x');
+        data[pos] = '<';
+        ASSERT_EQ(generator::FindEscapable(data, 0, EscapeContext::Text), pos);
+        ASSERT_EQ(generator::FindEscapable(data, pos + 1, EscapeContext::Text), std::string::npos);
+    }
+}
+
+TEST_F(HtmlEscapeTests, MatchesScalarReference) {
+    const std::string alphabet = "ab <>&\"' \t";
+    std::mt19937 rng(42);
+    for (size_t iteration = 0; iteration < 1000; ++iteration) {
+        std::string data(rng() % 100, ' ');
+        for (auto &c : data) {
+            c = alphabet[rng() % alphabet.size()];
+        }
+        for (auto context : {EscapeContext::Text, EscapeContext::Attribute}) {
+            std::string expected;
+            generator::AppendEscapedScalar(expected, data, context);
+            ASSERT_EQ(Escape(data, context), expected);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "PathTable.hpp"
+
+class PathTableTests : public ::testing::Test {
+ protected:
+    std::vector<std::string> paths = {
+        "b/file", "a/b/c", "a/b.txt", "a-b/file", "a/file.gmi", "file", "a/b/d/e", "a.txt",
+    };
+};
+
+TEST_F(PathTableTests, OrderMatchesPathSet) {
+    ffinder::PathTable table;
+    std::set<ffinder::PathTable::PathType> expected;
+    for (const auto &path : paths) {
+        table.emplace(path);
+        expected.emplace(path);
+    }
+
+    std::vector<ffinder::PathTable::PathType> result;
+    for (const auto &entry : table) {
+        result.push_back(entry.Path());
+    }
+    std::vector<ffinder::PathTable::PathType> expected_order(expected.begin(), expected.end());
+    ASSERT_EQ(result, expected_order);
+}
+
+TEST_F(PathTableTests, DuplicatesIgnored) {
+    ffinder::PathTable table;
+    ASSERT_TRUE(table.emplace("a/b/c"));
+    ASSERT_FALSE(table.emplace("a/b/c"));
+    ASSERT_TRUE(table.emplace("a/b/d"));
+    ASSERT_EQ(table.size(), 2);
+}
+
+TEST_F(PathTableTests, FileAndDirectoryConflictsRejected) {
+    ffinder::PathTable table;
+    ASSERT_TRUE(table.emplace("a/b/c"));
+    // Directory of the file can not be a file.
+    ASSERT_FALSE(table.emplace("a/b"));
+    ASSERT_FALSE(table.emplace("a"));
+    // File can not be a directory of another file.
+    ASSERT_FALSE(table.emplace("a/b/c/d"));
+    ASSERT_FALSE(table.EmplaceRelative("a/b/c/d/e"));
+    ASSERT_TRUE(table.emplace("a/b/e"));
+
+    std::vector<std::string> relative;
+    for (const auto &entry : table) {
+        relative.push_back(entry.RelativeString());
+    }
+    ASSERT_EQ(relative, (std::vector<std::string>{"a/b/c", "a/b/e"}));
+}
+
+TEST_F(PathTableTests, RelativeToRoot) {
+    ffinder::PathTable table("../input/");
+    table.emplace("../input/dir/file.gmi");
+    table.EmplaceRelative("other");
+
+    std::vector<std::string> relative;
+    std::vector<ffinder::PathTable::PathType> full;
+    for (const auto &entry : table) {
+        relative.push_back(entry.RelativeString());
+        full.push_back(entry.Path());
+    }
+    ASSERT_EQ(relative, (std::vector<std::string>{"dir/file.gmi", "other"}));
+    ASSERT_EQ(full, (std::vector<ffinder::PathTable::PathType>{"../input/dir/file.gmi", "../input/other"}));
+}
+
+TEST_F(PathTableTests, DirectoriesInterned) {
+    ffinder::PathTable table("root");
+    table.emplace("root/dir/file1");
+    table.emplace("root/dir/file2");
+    auto it = table.begin();
+    const auto first = *it;
+    const auto second = *++it;
+    ASSERT_EQ(first.Parent(), second.Parent());
+    ASSERT_EQ(first.Name(), "file1");
+    ASSERT_EQ(second.Name(), "file2");
+}
+
+TEST_F(PathTableTests, AbsolutePaths) {
+    ffinder::PathTable table = {"/abs/file", "rel/file"};
+    ffinder::PathTable other;
+    other.emplace("rel/file");
+    other.emplace("/abs/file");
+    ASSERT_TRUE(table == other);
+    ASSERT_EQ((*table.begin()).RelativeString(), "/abs/file");
+}
+
+TEST_F(PathTableTests, EqualityDependsOnRoot) {
+    ffinder::PathTable with_root("root");
+    with_root.EmplaceRelative("file");
+    ffinder::PathTable full = {"root/file"};
+    ffinder::PathTable other = {"other/file"};
+    ASSERT_TRUE(with_root == full);
+    ASSERT_FALSE(with_root == other);
+}
@@ -0,0 +1,232 @@
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PageCache.hpp"
+#include "PreviewServer.hpp"
+#include "TempDirectory.hpp"
+
+namespace fs = std::filesystem;
+
+class PageCacheTests : public ::testing::Test {
+ protected:
+    static generator::PageCache::ContentPtr Page(size_t size) { return std::make_shared<const std::string>(size, 'x'); }
+};
+
+TEST_F(PageCacheTests, GetReturnsPutPage) {
+    generator::PageCache cache(1024, 1);
+    auto page = Page(10);
+    cache.Put("page", 1, page);
+    EXPECT_EQ(cache.Get("page", 1), page);
+    EXPECT_EQ(cache.Get("other", 1), nullptr);
+    EXPECT_EQ(cache.Size(), 10);
+}
+
+TEST_F(PageCacheTests, ModifiedPageIsMissing) {
+    generator::PageCache cache(1024, 1);
+    cache.Put("page", 1, Page(10));
+    EXPECT_EQ(cache.Get("page", 2), nullptr);
+    EXPECT_EQ(cache.Size(), 0);
+}
+
+TEST_F(PageCacheTests, LeastRecentlyUsedPageIsEvicted) {
+    generator::PageCache cache(30, 1);
+    cache.Put("first", 1, Page(10));
+    cache.Put("second", 1, Page(10));
+    cache.Put("third", 1, Page(10));
+    ASSERT_NE(cache.Get("first", 1), nullptr);
+    cache.Put("fourth", 1, Page(10));
+
+    EXPECT_NE(cache.Get("first", 1), nullptr);
+    EXPECT_EQ(cache.Get("second", 1), nullptr);
+    EXPECT_NE(cache.Get("third", 1), nullptr);
+    EXPECT_NE(cache.Get("fourth", 1), nullptr);
+    EXPECT_EQ(cache.Size(), 30);
+}
+
+TEST_F(PageCacheTests, TooLargePageIsNotCached) {
+    generator::PageCache cache(30, 1);
+    cache.Put("small", 1, Page(10));
+    cache.Put("large", 1, Page(31));
+    EXPECT_EQ(cache.Get("large", 1), nullptr);
+    EXPECT_NE(cache.Get("small", 1), nullptr);
+}
+
+class PreviewServerTests : public ::testing::Test {
+ protected:
+    fs::path root;
+    std::unique_ptr<generator::PreviewServer> server;
+    uint16_t port = 0;
+
+    void SetUp() {
+        root = UniqueTempDirectory();
+        fs::create_directories(root / "dir");
+        Write(root / "page.gmi", "# Title\n");
+        Write(root / "dir" / "index.gmi", "Text\n");
+        Write(root / "style.css", "p {}\n");
+        server = std::make_unique<generator::PreviewServer>(root);
+        port = server->Start();
+    }
+
+    void TearDown() {
+        server.reset();
+        fs::remove_all(root);
+    }
+
+    static void Write(const fs::path &path, const std::string &content) { std::ofstream(path) << content; }
+
+    /**
+     * @return Connected socket or -1.
+     */
+    int Connect() const {
+        const int fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+        if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    std::string Request(const std::string &request) const {
+        const int fd = Connect();
+        if (fd < 0) {
+            return {};
+        }
+        send(fd, request.data(), request.size(), 0);
+        std::string response;
+        char buffer[4096];
+        for (ssize_t received; (received = recv(fd, buffer, sizeof(buffer), 0)) > 0;) {
+            response.append(buffer, static_cast<size_t>(received));
+        }
+        close(fd);
+        return response;
+    }
+
+    std::string Get(const std::string &target) const {
+        return Request("GET " + target + " HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n");
+    }
+
+    static std::string Body(const std::string &response) { return response.substr(response.find("\r\n\r\n") + 4); }
+};
+
+TEST_F(PreviewServerTests, PageIsTranslated) {
+    const auto response = Get("/page.html");
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0);
+    EXPECT_NE(response.find("Content-Type: text/html"), std::string::npos);
+    EXPECT_NE(Body(response).find("<h1>Title</h1>"), std::string::npos);
+    EXPECT_GT(server->Cache().Size(), 0);
+}
+
+TEST_F(PreviewServerTests, DirectoryIndexIsTranslated) {
+    EXPECT_NE(Get("/dir/").find("<p>Text</p>"), std::string::npos);
+    EXPECT_EQ(Get("/dir").rfind("HTTP/1.1 301", 0), 0);
+}
+
+TEST_F(PreviewServerTests, RedirectKeepsTargetEncoded) {
+    fs::create_directories(root / "my dir");
+    fs::create_directories(root / "dir\r\nSet-Cookie: a=1");
+    const auto response = Get("/my%20dir?query");
+    EXPECT_EQ(response.rfind("HTTP/1.1 301", 0), 0);
+    EXPECT_NE(response.find("\r\nLocation: /my%20dir/\r\n"), std::string::npos);
+    // Decoded control characters would end the Location header and start a new one.
+    const auto injected = Get("/dir%0d%0aSet-Cookie:%20a=1");
+    EXPECT_EQ(injected.rfind("HTTP/1.1 400", 0), 0);
+    EXPECT_EQ(injected.find("Set-Cookie"), std::string::npos);
+}
+
+TEST_F(PreviewServerTests, ModifiedPageIsTranslatedAgain) {
+    ASSERT_NE(Get("/page.html").find("<h1>Title</h1>"), std::string::npos);
+    Write(root / "page.gmi", "# Changed\n");
+    fs::last_write_time(root / "page.gmi", fs::last_write_time(root / "page.gmi") + std::chrono::seconds(1));
+    EXPECT_NE(Get("/page.html").find("<h1>Changed</h1>"), std::string::npos);
+}
+
+TEST_F(PreviewServerTests, AssetIsSent) {
+    const auto response = Get("/style.css");
+    EXPECT_NE(response.find("Content-Type: text/css"), std::string::npos);
+    EXPECT_EQ(Body(response), "p {}\n");
+    EXPECT_EQ(Body(Get("/page.gmi")), "# Title\n");
+}
+
+TEST_F(PreviewServerTests, HeadHasNoBody) {
+    const auto response = Request("HEAD /style.css HTTP/1.0\r\n\r\n");
+    EXPECT_NE(response.find("Content-Length: 5"), std::string::npos);
+    EXPECT_EQ(Body(response), "");
+}
+
+TEST_F(PreviewServerTests, InvalidRequests) {
+    EXPECT_EQ(Get("/missing.html").rfind("HTTP/1.1 404", 0), 0);
+    EXPECT_EQ(Get("/../etc/passwd").rfind("HTTP/1.1 400", 0), 0);
+    EXPECT_EQ(Get("/dir/%2e%2e/%2e%2e/etc/passwd").rfind("HTTP/1.1 400", 0), 0);
+    EXPECT_EQ(Request("POST /page.html HTTP/1.1\r\nConnection: close\r\n\r\n").rfind("HTTP/1.1 405", 0), 0);
+}
+
+TEST_F(PreviewServerTests, SymbolicLinksDoNotLeaveRoot) {
+    const fs::path outside = root.string() + ".outside";
+    fs::create_directories(outside);
+    Write(outside / "secret.txt", "secret\n");
+    Write(outside / "secret.gmi", "# Secret\n");
+    fs::create_symlink(outside / "secret.txt", root / "leak.txt");
+    fs::create_symlink(outside / "secret.gmi", root / "leak.gmi");
+    fs::create_symlink(outside, root / "outside");
+    fs::create_symlink(root / "style.css", root / "inside.css");
+
+    EXPECT_EQ(Get("/leak.txt").rfind("HTTP/1.1 404", 0), 0);
+    EXPECT_EQ(Get("/leak.html").rfind("HTTP/1.1 404", 0), 0);
+    EXPECT_EQ(Get("/outside/secret.txt").rfind("HTTP/1.1 404", 0), 0);
+    EXPECT_EQ(Get("/outside/").rfind("HTTP/1.1 404", 0), 0);
+    EXPECT_EQ(Body(Get("/inside.css")), "p {}\n");
+    fs::remove_all(outside);
+}
+
+TEST_F(PreviewServerTests, KeepAliveConnectionServesSeveralRequests) {
+    const auto response = Request(
+        "GET /style.css HTTP/1.1\r\n\r\n"
+        "GET /style.css HTTP/1.1\r\nConnection: close\r\n\r\n");
+    const size_t second = response.find("HTTP/1.1 200 OK", 1);
+    ASSERT_NE(second, std::string::npos);
+    EXPECT_NE(response.substr(0, second).find("Connection: keep-alive"), std::string::npos);
+    EXPECT_NE(response.find("Connection: close", second), std::string::npos);
+}
+
+TEST_F(PreviewServerTests, ParallelClients) {
+    std::vector<std::thread> clients;
+    std::vector<std::string> responses(16);
+    for (size_t i = 0; i < responses.size(); ++i) {
+        clients.emplace_back([this, &responses, i] { responses[i] = Get(i % 2 ? "/page.html" : "/style.css"); });
+    }
+    for (auto &client : clients) {
+        client.join();
+    }
+    for (const auto &response : responses) {
+        EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0);
+    }
+}
+
+TEST_F(PreviewServerTests, StopDoesNotWaitForIncompleteRequests) {
+    const int fd = Connect();
+    ASSERT_GE(fd, 0);
+    const std::string partial = "GET /style.css HTTP/1.1\r\n";
+    send(fd, partial.data(), partial.size(), 0);
+    // Worker takes the connection and waits for the rest of the request.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto start = std::chrono::steady_clock::now();
+    server.reset();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+    close(fd);
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <FSEntryFinder.hpp>
+#include <Generator.hpp>
+#include <Rules.hpp>
+
+#include "TempDirectory.hpp"
+
+class GlobPatternTests : public ::testing::Test {};
+
+TEST_F(GlobPatternTests, StarDoesNotCrossDirectories) {
+    ffinder::GlobPattern pattern("dir/*.gmi");
+    ASSERT_TRUE(pattern.Match("dir/file.gmi"));
+    ASSERT_FALSE(pattern.Match("dir/sub/file.gmi"));
+    ASSERT_FALSE(pattern.Match("dir/file.gmix"));
+}
+
+TEST_F(GlobPatternTests, BasenamePattern) {
+    ffinder::GlobPattern pattern("*.gmi");
+    ASSERT_TRUE(pattern.Match("file.gmi"));
+    ASSERT_TRUE(pattern.Match("a/b/file.gmi"));
+    ASSERT_FALSE(pattern.Match("a/file.gmi/other"));
+}
+
+TEST_F(GlobPatternTests, DoubleStar) {
+    ffinder::GlobPattern any_depth("a/**/b");
+    ASSERT_TRUE(any_depth.Match("a/b"));
+    ASSERT_TRUE(any_depth.Match("a/x/y/b"));
+    ASSERT_FALSE(any_depth.Match("a/xb"));
+
+    ffinder::GlobPattern leading("**/b");
+    ASSERT_TRUE(leading.Match("b"));
+    ASSERT_TRUE(leading.Match("x/y/b"));
+    ASSERT_FALSE(leading.Match("xb"));
+
+    ffinder::GlobPattern subtree("drafts/**");
+    ASSERT_TRUE(subtree.Match("drafts/x/y"));
+    ASSERT_FALSE(subtree.Match("drafts"));
+    ASSERT_TRUE(subtree.MatchDirectory("drafts"));
+    ASSERT_FALSE(subtree.MatchDirectory("drafts2"));
+}
+
+TEST_F(GlobPatternTests, CharacterClasses) {
+    ffinder::GlobPattern pattern("/file[0-9][!a]?");
+    ASSERT_TRUE(pattern.Match("file1bc"));
+    ASSERT_FALSE(pattern.Match("file1ac"));
+    ASSERT_FALSE(pattern.Match("filex12"));
+    ASSERT_FALSE(pattern.Match("dir/file123"));
+}
+
+TEST_F(GlobPatternTests, MayMatchBeneath) {
+    ffinder::GlobPattern file("drafts/keep.gmi");
+    ASSERT_TRUE(file.MayMatchBeneath("drafts"));
+    ASSERT_FALSE(file.MayMatchBeneath("drafts/old"));
+    ASSERT_FALSE(file.MayMatchBeneath("other"));
+    ASSERT_TRUE(ffinder::GlobPattern("*.gmi").MayMatchBeneath("any/dir"));
+    ASSERT_TRUE(ffinder::GlobPattern("**/keep/*").MayMatchBeneath("a/b"));
+}
+
+TEST_F(GlobPatternTests, AdjacentStars) {
+    ffinder::GlobPattern pattern("a**/**/*b");
+    ASSERT_TRUE(pattern.Match("ab"));
+    ASSERT_TRUE(pattern.Match("ax/y/zb"));
+    ASSERT_FALSE(pattern.Match("a/x"));
+}
+
+TEST_F(GlobPatternTests, InvalidPattern) {
+    ASSERT_THROW(ffinder::GlobPattern("file[0-9"), ffinder::exceptions::RuleSyntaxError);
+}
+
+class RuleSetTests : public ::testing::Test {
+ protected:
+    static constexpr std::string_view input = "../tests/GeneratorTestsData/input";
+    static constexpr std::string_view finder_input = "../tests/FSEntryFinderTestData";
+
+    const std::string config =
+        "# comment line\n"
+        "\n"
+        "exclude dir2/**\n"
+        "skip .gitkeep\n"
+        "translate ord_file gemtext\n"
+        "translate subdir/*.gmi copy\n";
+
+    ffinder::PathType output;
+
+    void SetUp() {
+        output = UniqueTempDirectory();
+    }
+
+    void TearDown() { ffinder::fs::remove_all(output); }
+
+    std::shared_ptr<const ffinder::RuleSet> MakeRules(const std::string &text) {
+        std::istringstream iss(text);
+        return std::make_shared<const ffinder::RuleSet>(ffinder::RuleSet::Parse(iss));
+    }
+};
+
+TEST_F(RuleSetTests, ParseInvalid) {
+    std::istringstream unknown("remove *.gmi");
+    ASSERT_THROW(ffinder::RuleSet::Parse(unknown), ffinder::exceptions::RuleSyntaxError);
+    std::istringstream no_translator("translate *.gmi");
+    ASSERT_THROW(ffinder::RuleSet::Parse(no_translator), ffinder::exceptions::RuleSyntaxError);
+}
+
+TEST_F(RuleSetTests, LoadNotExistFile) {
+    ASSERT_THROW(ffinder::RuleSet::Load("not_exist_rules"), ffinder::exceptions::RulesFileError);
+}
+
+TEST_F(RuleSetTests, LastIncludeExcludeWins) {
+    auto rules = MakeRules("include *.gmi\nexclude drafts/**\ninclude drafts/keep.gmi\n");
+    ASSERT_FALSE(rules->IsExcluded("a.gmi", false));
+    ASSERT_TRUE(rules->IsExcluded("a.png", false));
+    ASSERT_TRUE(rules->IsExcluded("drafts/a.gmi", false));
+    ASSERT_FALSE(rules->IsExcluded("drafts/keep.gmi", false));
+    ASSERT_FALSE(rules->IsExcluded("images", true));
+    ASSERT_FALSE(rules->IsExcluded("drafts", true));
+    ASSERT_TRUE(rules->IsExcluded("drafts/old", true));
+}
+
+TEST_F(RuleSetTests, ExcludedDirectoryExcludesFiles) {
+    for (const auto *excluded : {"drafts", "/drafts"}) {
+        auto rules = MakeRules(std::string("include *.gmi\nexclude ") + excluded + "\ninclude /drafts/keep.gmi\n");
+        ASSERT_FALSE(rules->IsExcluded("drafts", true)) << excluded;
+        ASSERT_TRUE(rules->IsExcluded("drafts/other.gmi", false)) << excluded;
+        ASSERT_FALSE(rules->IsExcluded("drafts/keep.gmi", false)) << excluded;
+        ASSERT_TRUE(rules->IsExcluded("drafts/old", true)) << excluded;
+        ASSERT_TRUE(rules->IsExcluded("drafts/old/keep.gmi", false)) << excluded;
+        ASSERT_FALSE(rules->IsExcluded("a.gmi", false)) << excluded;
+
+        rules = MakeRules(std::string("include *.gmi\nexclude ") + excluded + "\n");
+        ASSERT_TRUE(rules->IsExcluded("drafts", true)) << excluded;
+        ASSERT_TRUE(rules->IsExcluded("drafts/other.gmi", false)) << excluded;
+        ASSERT_TRUE(rules->IsExcluded("drafts/keep.gmi", false)) << excluded;
+    }
+    // Only anchored pattern excludes the top level directory alone.
+    auto rules = MakeRules("exclude /drafts\n");
+    ASSERT_FALSE(rules->IsExcluded("posts/drafts/a.gmi", false));
+    rules = MakeRules("exclude drafts\n");
+    ASSERT_TRUE(rules->IsExcluded("posts/drafts/a.gmi", false));
+}
+
+TEST_F(RuleSetTests, IncludeBeneathExcludedDirectory) {
+    ffinder::fs::create_directories(output / "input/drafts/old");
+    for (const auto *file : {"a.gmi", "drafts/keep.gmi", "drafts/other.gmi", "drafts/old/keep.gmi"}) {
+        std::ofstream(output / "input" / file) << "text\n";
+    }
+    auto rules = MakeRules("include *.gmi\nexclude drafts/**\ninclude drafts/keep.gmi\n");
+    generator::GemtextGenerator gemtext_generator(ffinder::CreateFinder<ffinder::RFilteredFileFinder>(rules));
+    gemtext_generator.SetRules(rules);
+    ffinder::fs::create_directories(output / "output");
+    gemtext_generator.Generate(output / "input", output / "output");
+
+    auto finder = ffinder::CreateFinder<ffinder::RRegularFileFinder>();
+    ffinder::FSEntityList expected = {
+        output / "output/a.html",
+        output / "output/drafts/keep.html",
+    };
+    ASSERT_TRUE(finder->CreateFilesList(output / "output") == expected);
+}
+
+TEST_F(RuleSetTests, FinderPrunesExcludedSubtree) {
+    auto finder = ffinder::CreateFinder<ffinder::RFilteredFileFinder>(MakeRules(config));
+    ffinder::FSEntityList expected = {
+        std::string(finder_input) + "/file1",
+        std::string(finder_input) + "/dir1/file2",
+    };
+    ASSERT_TRUE(finder->CreateFilesList(finder_input) == expected);
+}
+
+TEST_F(RuleSetTests, GeneratorRoutesBySkipAndTranslateRules) {
+    auto rules = MakeRules(config);
+    generator::GemtextGenerator gemtext_generator(ffinder::CreateFinder<ffinder::RFilteredFileFinder>(rules));
+    gemtext_generator.SetRules(rules);
+    gemtext_generator.Generate(input, output);
+
+    auto finder = ffinder::CreateFinder<ffinder::RRegularFileFinder>();
+    ffinder::FSEntityList expected = {
+        output / "markup.html",
+        output / "ord_file.html",
+        output / "subdir/markup2.gmi",
+    };
+    ASSERT_TRUE(finder->CreateFilesList(output) == expected);
+}
+
+TEST_F(RuleSetTests, GeneratorUnknownTranslator) {
+    generator::GemtextGenerator gemtext_generator;
+    ASSERT_THROW(gemtext_generator.SetRules(MakeRules("translate *.gmi markdown\n")),
+                 generator::exceptions::UnknownTranslatorError);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Scheduler.hpp"
+
+class SchedulerTests : public ::testing::Test {
+ protected:
+    std::mutex mutex;
+    std::vector<uintmax_t> order;
+
+    generator::SizeAwareScheduler::TaskType Record(uintmax_t size) {
+        return [this, size] {
+            std::lock_guard lock(mutex);
+            order.push_back(size);
+        };
+    }
+};
+
+TEST_F(SchedulerTests, LargestJobsFirst) {
+    generator::SizeAwareScheduler scheduler({1, 0, 1});
+    for (uintmax_t size : {3, 10, 1, 7}) {
+        scheduler.AddCpuJob(size, Record(size));
+    }
+    for (uintmax_t size : {5, 50}) {
+        scheduler.AddIoJob(size, 0, Record(size));
+    }
+    scheduler.Run();
+    // Single CPU worker drains translations first and then helps with copies.
+    ASSERT_EQ(order, (std::vector<uintmax_t>{10, 7, 3, 1, 50, 5}));
+}
+
+TEST_F(SchedulerTests, IoLimitedPerDevice) {
+    constexpr size_t per_device = 2;
+    std::atomic<size_t> in_flight[2] = {0, 0};
+    std::atomic<size_t> max_in_flight[2] = {0, 0};
+    std::atomic<size_t> done = 0;
+
+    generator::SizeAwareScheduler scheduler({2, 4, per_device, 0});
+    for (size_t i = 0; i < 16; ++i) {
+        const size_t device = i % 2;
+        scheduler.AddIoJob(i, device, [&, device] {
+            const size_t current = ++in_flight[device];
+            size_t expected = max_in_flight[device];
+            while (current > expected && !max_in_flight[device].compare_exchange_weak(expected, current)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            --in_flight[device];
+            ++done;
+        });
+    }
+    scheduler.Run();
+    ASSERT_EQ(done, 16);
+    ASSERT_LE(max_in_flight[0], per_device);
+    ASSERT_LE(max_in_flight[1], per_device);
+}
+
+TEST_F(SchedulerTests, ExceptionRethrown) {
+    generator::SizeAwareScheduler scheduler({1, 1, 1, 0});
+    scheduler.AddCpuJob(2, [] { throw std::runtime_error("job failed"); });
+    scheduler.AddCpuJob(1, Record(1));
+    scheduler.AddIoJob(1, 0, [] {});
+    ASSERT_THROW(scheduler.Run(), std::runtime_error);
+    // Jobs, that are not started after failure, are dropped.
+    ASSERT_TRUE(order.empty());
+}
+
+TEST_F(SchedulerTests, SmallRunOnCallingThread) {
+    std::vector<std::thread::id> threads;
+    const auto RecordThread = [&] {
+        std::lock_guard lock(mutex);
+        threads.push_back(std::this_thread::get_id());
+    };
+    generator::SizeAwareScheduler scheduler({4, 4, 2, 1000});
+    for (uintmax_t size : {10, 20, 30}) {
+        scheduler.AddCpuJob(size, RecordThread);
+        scheduler.AddIoJob(size, size, RecordThread);
+    }
+    scheduler.Run();
+    ASSERT_EQ(threads, std::vector<std::thread::id>(6, std::this_thread::get_id()));
+}
+
+TEST_F(SchedulerTests, ZeroIoPerDeviceIsClamped) {
+    generator::SizeAwareScheduler scheduler({2, 2, 0, 0});
+    for (uintmax_t size : {1, 2, 3}) {
+        scheduler.AddIoJob(size, 0, Record(size));
+    }
+    scheduler.Run();
+    std::sort(order.begin(), order.end());
+    ASSERT_EQ(order, (std::vector<uintmax_t>{1, 2, 3}));
+}
@@ -0,0 +1,59 @@
+# Generates one input by SHARDS concurrent generator processes, one per shard, merges their
+# manifests and checks, that the output is the same as the output of a single process.
+#
+# Variables: GENERATOR - path to the generator, SHARDS - number of shards, WORK_DIR - scratch directory.
+
+cmake_minimum_required(VERSION 3.16)
+
+file(REMOVE_RECURSE ${WORK_DIR})
+foreach (dir IN ITEMS . a a/b c d/e/f)
+    foreach (i RANGE 7)
+        file(WRITE "${WORK_DIR}/input/${dir}/page${i}.gmi" "# Page ${i}\n* ${dir}\n=> /index.html Home\n")
+        file(WRITE "${WORK_DIR}/input/${dir}/style${i}.css" "p { margin: ${i}px; }\n")
+    endforeach ()
+endforeach ()
+file(MAKE_DIRECTORY ${WORK_DIR}/reference ${WORK_DIR}/sharded)
+
+function(run_checked)
+    execute_process(COMMAND ${ARGN} WORKING_DIRECTORY ${WORK_DIR} RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "'${ARGN}' failed: ${result}")
+    endif ()
+endfunction()
+
+# The single shard writes a manifest too, so merged manifests are compared as well.
+run_checked(${GENERATOR} input reference --shard 0/1)
+run_checked(${GENERATOR} reference --merge 1)
+
+# Commands of one execute_process are started together as a pipeline, so shards run concurrently.
+set(commands)
+math(EXPR last_shard "${SHARDS} - 1")
+foreach (shard RANGE ${last_shard})
+    list(APPEND commands COMMAND ${GENERATOR} input sharded --shard ${shard}/${SHARDS})
+endforeach ()
+execute_process(${commands} WORKING_DIRECTORY ${WORK_DIR} RESULTS_VARIABLE results)
+foreach (result IN LISTS results)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Shard process failed: ${results}")
+    endif ()
+endforeach ()
+run_checked(${GENERATOR} sharded --merge ${SHARDS})
+
+file(GLOB_RECURSE reference_files LIST_DIRECTORIES false RELATIVE ${WORK_DIR}/reference ${WORK_DIR}/reference/*)
+file(GLOB_RECURSE sharded_files LIST_DIRECTORIES false RELATIVE ${WORK_DIR}/sharded ${WORK_DIR}/sharded/*)
+list(SORT reference_files)
+list(SORT sharded_files)
+if (NOT reference_files STREQUAL sharded_files)
+    message(FATAL_ERROR "Sharded output differs.\nExpected: ${reference_files}\nActual: ${sharded_files}")
+endif ()
+if (NOT ".manifest" IN_LIST sharded_files)
+    message(FATAL_ERROR "Merged manifest is missing: ${sharded_files}")
+endif ()
+foreach (file IN LISTS reference_files)
+    file(READ ${WORK_DIR}/reference/${file} expected)
+    file(READ ${WORK_DIR}/sharded/${file} actual)
+    if (NOT expected STREQUAL actual)
+        message(FATAL_ERROR "Sharded ${file} differs from the single process one")
+    endif ()
+endforeach ()
+file(REMOVE_RECURSE ${WORK_DIR})
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <FSEntryFinder.hpp>
+#include <Generator.hpp>
+#include <Sharding.hpp>
+
+#include "TempDirectory.hpp"
+
+class ShardingTests : public ::testing::Test {
+ protected:
+    static constexpr std::string_view input = "../tests/GeneratorTestsData/input";
+    static constexpr size_t shards_count = 3;
+
+    ffinder::PathType output;
+    std::vector<ffinder::PathType> files = {
+        "a/file1.gmi", "a/file2", "a/b/file3.gmi", "c/file4", "c/d/e/file5", "file6", "file7.gmi",
+    };
+
+    void SetUp() {
+        output = UniqueTempDirectory();
+    }
+
+    void TearDown() { ffinder::fs::remove_all(output); }
+};
+
+TEST_F(ShardingTests, ParseValid) {
+    generator::ShardSpec spec = generator::ShardSpec::Parse("2/5");
+    ASSERT_EQ(spec.index, 2);
+    ASSERT_EQ(spec.count, 5);
+}
+
+TEST_F(ShardingTests, ParseInvalid) {
+    ASSERT_THROW(generator::ShardSpec::Parse("5/5"), generator::exceptions::InvalidShardSpecError);
+    ASSERT_THROW(generator::ShardSpec::Parse("1/0"), generator::exceptions::InvalidShardSpecError);
+    ASSERT_THROW(generator::ShardSpec::Parse("1"), generator::exceptions::InvalidShardSpecError);
+    ASSERT_THROW(generator::ShardSpec::Parse("a/2"), generator::exceptions::InvalidShardSpecError);
+    ASSERT_THROW(generator::ShardSpec::Parse("1/2x"), generator::exceptions::InvalidShardSpecError);
+}
+
+TEST_F(ShardingTests, PartitionDisjointAndComplete) {
+    for (const auto &file : files) {
+        size_t owners = 0;
+        for (size_t index = 0; index < shards_count; ++index) {
+            owners += generator::ShardPartitioner({index, shards_count}).Owns(file);
+        }
+        ASSERT_EQ(owners, 1);
+    }
+}
+
+TEST_F(ShardingTests, DirectoryAffinity) {
+    generator::ShardPartitioner partitioner({0, shards_count});
+    ASSERT_EQ(partitioner.ShardOf("a/file1.gmi"), partitioner.ShardOf("a/file2"));
+    ASSERT_EQ(partitioner.ShardOf("file6"), partitioner.ShardOf("file7.gmi"));
+}
+
+TEST_F(ShardingTests, StableHash) {
+    // FNV-1a test vector, partition must not depend on host or standard library.
+    ASSERT_EQ(generator::ShardPartitioner::Hash("a"), 0xaf63dc4c8601ec8cULL);
+}
+
+TEST_F(ShardingTests, ShardedGenerationMatchesSingle) {
+    auto finder = ffinder::CreateFinder<ffinder::RRegularFileFinder>();
+    for (size_t index = 0; index < shards_count; ++index) {
+        generator::GemtextGenerator gemtext_generator(finder);
+        gemtext_generator.SetShard({index, shards_count});
+        gemtext_generator.Generate(input, output);
+    }
+    generator::MergeShardManifests(output, shards_count);
+
+    ffinder::FSEntityList expected = {
+        output / ".gitkeep",
+        output / "markup.html",
+        output / "ord_file",
+        output / "subdir/markup2.html",
+        output / generator::MANIFEST_NAME,
+    };
+    ASSERT_TRUE(finder->CreateFilesList(output) == expected);
+
+    std::ifstream manifest(output / generator::MANIFEST_NAME);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(manifest, line);) {
+        lines.push_back(line);
+    }
+    std::vector<std::string> expected_lines = {".gitkeep", "markup.html", "ord_file", "subdir/markup2.html"};
+    ASSERT_EQ(lines, expected_lines);
+}
+
+TEST_F(ShardingTests, SingleShardWritesManifest) {
+    generator::GemtextGenerator gemtext_generator(ffinder::CreateFinder<ffinder::RRegularFileFinder>());
+    gemtext_generator.SetShard({0, 1});
+    gemtext_generator.Generate(input, output);
+    ASSERT_TRUE(ffinder::fs::exists(generator::ShardManifestPath(output, {0, 1})));
+    generator::MergeShardManifests(output, 1);
+    ASSERT_TRUE(ffinder::fs::exists(output / generator::MANIFEST_NAME));
+}
+
+TEST_F(ShardingTests, MergeMissingManifest) {
+    ASSERT_THROW(generator::MergeShardManifests(output, shards_count), generator::exceptions::ShardManifestError);
+}
+
+TEST_F(ShardingTests, MergeThroughFileSystem) {
+    auto file_system = std::make_shared<ffinder::MemoryFileSystem>();
+    file_system->AddFile(generator::ShardManifestPath("out", {0, 2}), "b\na\n");
+    file_system->AddFile(generator::ShardManifestPath("out", {1, 2}), "c\n");
+    generator::MergeShardManifests("out", 2, file_system);
+
+    ASSERT_EQ(file_system->ReadFile(ffinder::PathType("out") / generator::MANIFEST_NAME), "a\nb\nc\n");
+    ASSERT_FALSE(file_system->Exists(generator::ShardManifestPath("out", {0, 2})));
+    ASSERT_FALSE(file_system->Exists(generator::ShardManifestPath("out", {1, 2})));
+}
@@ -0,0 +1,23 @@
+#ifndef TESTS_TEMPDIRECTORY_HPP_
+#define TESTS_TEMPDIRECTORY_HPP_
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <string>
+
+/**
+ * Path of an empty temporary directory, that is unique for the running test. Test cases are run
+ * by ctest in parallel processes, so a shared directory would be removed by other cases.
+ */
+inline std::filesystem::path UniqueTempDirectory() {
+    const auto *test = ::testing::UnitTest::GetInstance()->current_test_info();
+    const auto path = std::filesystem::temp_directory_path() / (std::string(test->test_suite_name()) + '.' +
+                                                                test->name() + '.' + std::to_string(getpid()));
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path;
+}
+
+#endif  // TESTS_TEMPDIRECTORY_HPP_
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "GemtextCorpus.hpp"
+#include "Translator.hpp"
+#include "TranslatorHarness.hpp"
+
+class TranslatorFuzzTests : public ::testing::Test {
+ protected:
+    static constexpr size_t DOCUMENTS = 2000;
+    static constexpr size_t MAX_DOCUMENT_LINES = 32;
+    static constexpr size_t PATHOLOGICAL_DOCUMENT_SIZE = 1 << 16;
+};
+
+TEST_F(TranslatorFuzzTests, ReferenceMatchesHandcraftedCase) {
+    ASSERT_EQ(generator::ReferenceGemToHTML("=> /page.gmi  Page"),
+              "<!DOCTYPE html>\n<html lang=\"en\">\n<head>\n\t<meta charset=\"UTF-8\">\n\t<title>Title</title>\n"
+              "</head>\n<body>\n<a href=\"/page.gmi\">Page</a>\n</body>\n</html>");
+    ASSERT_THROW(generator::ReferenceGemToHTML("#"), generator::exceptions::HeaderFormatError);
+}
+
+TEST_F(TranslatorFuzzTests, EdgeCases) {
+    for (const char *input : {"", "\n", "#", "####", "#### x", "=>", "=>   ", "=> url   ", "=> url \t text", "*", "* ",
+                              ">", "```", "```\n```", "* a\n```\n* b\n```", "a\r\nb", "<&>\"'"}) {
+        const auto report = generator::CheckTranslation(input);
+        EXPECT_TRUE(report.consistent) << '"' << input << "\": " << report.mismatch;
+    }
+}
+
+TEST_F(TranslatorFuzzTests, GeneratedCorpus) {
+    generator::GemtextCorpusGenerator corpus(2023);
+    for (size_t i = 0; i < DOCUMENTS; ++i) {
+        const std::string document = corpus.Document(1 + i % MAX_DOCUMENT_LINES);
+        const auto report = generator::CheckTranslation(document);
+        ASSERT_TRUE(report.consistent) << report.mismatch << "\nInput:\n" << document;
+    }
+}
+
+// Linear time of pathological documents is checked by TranslatorScalingBenchmark and the fuzzer,
+// wall clock ratios are too noisy for unit tests.
+TEST_F(TranslatorFuzzTests, PathologicalDocuments) {
+    size_t index = 0;
+    for (const auto &document : generator::GemtextCorpusGenerator::PathologicalDocuments(PATHOLOGICAL_DOCUMENT_SIZE)) {
+        const auto report = generator::CheckTranslation(document);
+        EXPECT_TRUE(report.consistent) << "Document " << index << ": " << report.mismatch;
+        ++index;
+    }
+}
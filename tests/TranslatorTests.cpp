@@ -41,7 +41,7 @@ class TranslatorTests : public ::testing::Test {
         "<li>list1</li>\n"
         "<li>list2</li>\n"
         "</ul>\n"
-        "<a href=\"http://some-address.com\">http://some-address.com Line</a>\n"
+        "<a href=\"http://some-address.com\">Line</a>\n"
         "</body>\n"
         "</html>";
 
@@ -60,6 +60,28 @@ class TranslatorTests : public ::testing::Test {
         "</body>\n"
         "</html>";
 
+    const std::string unsafe_input =
+        "a < b & c\n"
+        "=> /search?q=\"x\"&y=1 <link>\n"
+        "```\n"
+        "<pre>\n"
+        "```";
+    const std::string unsafe_expected =
+        "<!DOCTYPE html>\n"
+        "<html lang=\"en\">\n"
+        "<head>\n"
+        "\t<meta charset=\"UTF-8\">\n"
+        "\t<title>Title</title>\n"
+        "</head>\n"
+        "<body>\n"
+        "<p>a &lt; b &amp; c</p>\n"
+        "<a href=\"/search?q=&quot;x&quot;&amp;y=1\">&lt;link&gt;</a>\n"
+        "\n"
+        "&lt;pre&gt;\n"
+        "\n"
+        "</body>\n"
+        "</html>";
+
     void SetUp() {
         default_translator = generator::CreateTranslator<DefaultTranslator>();
         gem_to_html_translator = generator::CreateTranslator<GemToHTMLTranslator>();
@@ -119,3 +141,11 @@ TEST_F(TranslatorTests, GemToHTMLTranslatorListEnds) {
     std::string result = oss.str();
     ASSERT_STREQ(result.c_str(), list_ends_expected.c_str());
 }
+
+TEST_F(TranslatorTests, GemToHTMLTranslatorEscaping) {
+    std::istringstream iss(unsafe_input);
+    std::ostringstream oss;
+    gem_to_html_translator->Translate(iss, oss);
+    std::string result = oss.str();
+    ASSERT_STREQ(result.c_str(), unsafe_expected.c_str());
+}
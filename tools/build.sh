@@ -7,7 +7,7 @@ TTY_COLOR_RESET=$(tput sgr0)
 
 BINARY_DIR="build"
 CMAKE_OPTIONS=""
-while getopts "tc" opt; do
+while getopts "tcf" opt; do
   case $opt in
   t)
     CMAKE_OPTIONS="$CMAKE_OPTIONS -DTEST=ON "
@@ -15,6 +15,9 @@ while getopts "tc" opt; do
   c)
     CMAKE_OPTIONS="$CMAKE_OPTIONS -DCMAKE_EXPORT_COMPILE_COMMANDS=ON "
     ;;
+  f)
+    CMAKE_OPTIONS="$CMAKE_OPTIONS -DFUZZ=ON "
+    ;;
   a*)
     echo "Unexpected flag $opt"
     exit 1
@@ -0,0 +1,50 @@
+#!/bin/bash
+
+# Builds WebsiteGeneratorRelease with profile guided optimization. The profile is collected by
+# generating the bundled benchmark capsule with the instrumented build.
+# Usage: tools/pgo.sh [binary_dir] [training_runs]
+
+INFO_TTY_COLOR=$(tput setaf 5 && tput bold)
+SUCCESS_TTY_COLOR=$(tput setaf 2)
+ERROR_TTY_COLOR=$(tput setaf 1 && tput bold)
+TTY_COLOR_RESET=$(tput sgr0)
+
+SOURCE_DIR=$(cd "$(dirname "$0")/.." && pwd)
+BINARY_DIR=$(realpath -m "${1:-build-pgo}")
+TRAINING_RUNS=${2:-100}
+PROFILE_DIR="$BINARY_DIR/pgo-profile"
+CAPSULE="$SOURCE_DIR/bench/capsule"
+RELEASE_TARGET=WebsiteGeneratorRelease
+
+function fail() {
+  echo "${ERROR_TTY_COLOR}$1${TTY_COLOR_RESET}"
+  exit 1
+}
+
+function build() {
+  cmake -S "$SOURCE_DIR" -B "$BINARY_DIR" -DWEBSITE_GENERATOR_RELEASE=ON -DPGO="$1" -DPGO_PROFILE_DIR="$PROFILE_DIR" \
+    >/dev/null &&
+    cmake --build "$BINARY_DIR" --target $RELEASE_TARGET -j"$(nproc)"
+}
+
+echo "${INFO_TTY_COLOR}Building instrumented $RELEASE_TARGET${TTY_COLOR_RESET}"
+rm -rf "$PROFILE_DIR"
+build GENERATE || fail "Instrumented build failed"
+
+echo "${INFO_TTY_COLOR}Training on $CAPSULE ($TRAINING_RUNS runs)${TTY_COLOR_RESET}"
+OUTPUT_DIR=$(mktemp -d)
+for ((i = 0; i < TRAINING_RUNS; ++i)); do
+  rm -rf "$OUTPUT_DIR" && mkdir "$OUTPUT_DIR"
+  "$BINARY_DIR/$RELEASE_TARGET" "$CAPSULE" "$OUTPUT_DIR" || fail "Training run failed"
+done
+rm -rf "$OUTPUT_DIR"
+
+# Clang writes raw profiles, that should be merged, GCC uses its profiles directly.
+if compgen -G "$PROFILE_DIR/*.profraw" >/dev/null; then
+  llvm-profdata merge -output="$PROFILE_DIR/default.profdata" "$PROFILE_DIR"/*.profraw || fail "Profile merge failed"
+fi
+
+echo "${INFO_TTY_COLOR}Building optimized $RELEASE_TARGET${TTY_COLOR_RESET}"
+build USE || fail "Optimized build failed"
+
+echo "${SUCCESS_TTY_COLOR}$BINARY_DIR/$RELEASE_TARGET is built with profile guided optimization${TTY_COLOR_RESET}"